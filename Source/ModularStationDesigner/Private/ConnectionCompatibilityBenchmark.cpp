@@ -0,0 +1,156 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ConnectionCompatibility.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+
+#if !UE_BUILD_SHIPPING
+
+namespace
+{
+	/** Branch-based rules that CanConnectTo used before the lookup table, kept as the benchmark baseline */
+	bool LegacyAreTypesCompatible(EConnectionType TypeA, EConnectionType TypeB)
+	{
+		if (TypeA == EConnectionType::Universal || TypeB == EConnectionType::Universal)
+		{
+			return true;
+		}
+		if (TypeA == EConnectionType::Standard)
+		{
+			return (TypeB == EConnectionType::Standard || TypeB == EConnectionType::Corridor);
+		}
+		if (TypeA == EConnectionType::Corridor)
+		{
+			return (TypeB != EConnectionType::Docking);
+		}
+		if (TypeA == EConnectionType::Docking)
+		{
+			return (TypeB != EConnectionType::Docking);
+		}
+		if (TypeA == EConnectionType::Power)
+		{
+			return (TypeB == EConnectionType::Power);
+		}
+		return (TypeA == TypeB);
+	}
+
+	bool LegacyAreSizesCompatible(EConnectionSize SizeA, EConnectionSize SizeB)
+	{
+		if (SizeA == EConnectionSize::Universal || SizeB == EConnectionSize::Universal)
+		{
+			return true;
+		}
+		if (SizeA == SizeB)
+		{
+			return true;
+		}
+		int32 SizeDiff = FMath::Abs(static_cast<int32>(SizeA) - static_cast<int32>(SizeB));
+		return (SizeDiff == 1);
+	}
+
+	struct FBenchmarkPoint
+	{
+		EConnectionType Type;
+		EConnectionSize Size;
+		bool bIsOccupied;
+	};
+
+	void RunCompatibilityBenchmark(const TArray<FString>& Args)
+	{
+		int32 NumPairs = 10 * 1000 * 1000;
+		if (Args.Num() > 0)
+		{
+			NumPairs = FMath::Max(1, FCString::Atoi(*Args[0]));
+		}
+
+		// Exhaustive equivalence check over every (type, size) pair
+		int32 NumMismatches = 0;
+		for (int32 SourceKey = 0; SourceKey < ConnectionCompatibility::NumKeys; ++SourceKey)
+		{
+			for (int32 TargetKey = 0; TargetKey < ConnectionCompatibility::NumKeys; ++TargetKey)
+			{
+				const EConnectionType SourceType = static_cast<EConnectionType>(SourceKey / ConnectionCompatibility::NumSizes);
+				const EConnectionSize SourceSize = static_cast<EConnectionSize>(SourceKey % ConnectionCompatibility::NumSizes);
+				const EConnectionType TargetType = static_cast<EConnectionType>(TargetKey / ConnectionCompatibility::NumSizes);
+				const EConnectionSize TargetSize = static_cast<EConnectionSize>(TargetKey % ConnectionCompatibility::NumSizes);
+
+				const bool bLegacy = LegacyAreTypesCompatible(SourceType, TargetType) && LegacyAreSizesCompatible(SourceSize, TargetSize);
+				const bool bTable = ConnectionCompatibility::AreCompatible(SourceType, SourceSize, TargetType, TargetSize);
+				if (bLegacy != bTable)
+				{
+					++NumMismatches;
+				}
+			}
+		}
+
+		// Random candidate pool, sized to stay in cache so the comparison measures the checks themselves
+		const int32 PoolSize = 1 << 14;
+		const int32 PoolMask = PoolSize - 1;
+		FRandomStream Random(1337);
+
+		TArray<FBenchmarkPoint> Points;
+		TArray<uint32> KeyBits;
+		TArray<uint32> Masks;
+		Points.SetNumUninitialized(PoolSize);
+		KeyBits.SetNumUninitialized(PoolSize);
+		Masks.SetNumUninitialized(PoolSize);
+
+		for (int32 i = 0; i < PoolSize; ++i)
+		{
+			FBenchmarkPoint& Point = Points[i];
+			Point.Type = static_cast<EConnectionType>(Random.RandRange(0, ConnectionCompatibility::NumTypes - 1));
+			Point.Size = static_cast<EConnectionSize>(Random.RandRange(0, ConnectionCompatibility::NumSizes - 1));
+			Point.bIsOccupied = Random.FRand() < 0.1f;
+
+			// Occupied points accept nothing, so fold occupancy into the mask as well
+			KeyBits[i] = ConnectionCompatibility::GetKeyBit(Point.Type, Point.Size);
+			Masks[i] = Point.bIsOccupied ? 0u : ConnectionCompatibility::GetCompatibilityMask(Point.Type, Point.Size);
+		}
+
+		// Legacy branch chains
+		int32 LegacyMatches = 0;
+		const double LegacyStart = FPlatformTime::Seconds();
+		for (int32 i = 0; i < NumPairs; ++i)
+		{
+			const FBenchmarkPoint& Source = Points[i & PoolMask];
+			const FBenchmarkPoint& Target = Points[(i * 7919) & PoolMask];
+			if (!Source.bIsOccupied && !Target.bIsOccupied &&
+				LegacyAreTypesCompatible(Source.Type, Target.Type) &&
+				LegacyAreSizesCompatible(Source.Size, Target.Size))
+			{
+				++LegacyMatches;
+			}
+		}
+		const double LegacySeconds = FPlatformTime::Seconds() - LegacyStart;
+
+		// Precomputed masks: one AND per pair
+		int32 TableMatches = 0;
+		const double TableStart = FPlatformTime::Seconds();
+		for (int32 i = 0; i < NumPairs; ++i)
+		{
+			const int32 TargetIndex = (i * 7919) & PoolMask;
+			const uint32 TargetBit = Points[TargetIndex].bIsOccupied ? 0u : KeyBits[TargetIndex];
+			TableMatches += (Masks[i & PoolMask] & TargetBit) != 0 ? 1 : 0;
+		}
+		const double TableSeconds = FPlatformTime::Seconds() - TableStart;
+
+		UE_LOG(LogTemp, Display, TEXT("Connection compatibility benchmark: %d pairs"), NumPairs);
+		UE_LOG(LogTemp, Display, TEXT("  Branches: %.3f ms (%d compatible)"), LegacySeconds * 1000.0, LegacyMatches);
+		UE_LOG(LogTemp, Display, TEXT("  Table:    %.3f ms (%d compatible)"), TableSeconds * 1000.0, TableMatches);
+		UE_LOG(LogTemp, Display, TEXT("  Speedup:  %.2fx"), TableSeconds > 0.0 ? LegacySeconds / TableSeconds : 0.0);
+
+		if (NumMismatches > 0 || LegacyMatches != TableMatches)
+		{
+			UE_LOG(LogTemp, Error, TEXT("Compatibility table disagrees with legacy rules (%d key mismatches, %d vs %d matches)"),
+				NumMismatches, LegacyMatches, TableMatches);
+		}
+	}
+
+	FAutoConsoleCommand BenchmarkCompatibilityCommand(
+		TEXT("StationDesigner.BenchmarkCompatibility"),
+		TEXT("Compare branch-based and table-based connection compatibility checks. Usage: StationDesigner.BenchmarkCompatibility [NumPairs]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&RunCompatibilityBenchmark));
+}
+
+#endif // !UE_BUILD_SHIPPING
@@ -1,6 +1,8 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "ConnectionPoint.h"
+#include "ConnectionPointRegistry.h"
+#include "ConnectionCompatibility.h"
 
 UConnectionPointComponent::UConnectionPointComponent()
 {
@@ -12,6 +14,9 @@ UConnectionPointComponent::UConnectionPointComponent()
 	bIsOccupied = false;
 	ConnectedModule = nullptr;
 	SnapDistance = 50.0f; // 50cm snap threshold
+	
+	// Needed to keep the registry cell up to date when the owning module moves
+	bWantsOnUpdateTransform = true;
 }
 
 void UConnectionPointComponent::BeginPlay()
@@ -19,32 +24,56 @@ void UConnectionPointComponent::BeginPlay()
 	Super::BeginPlay();
 }
 
-bool UConnectionPointComponent::CanConnectTo(UConnectionPointComponent* OtherPoint) const
+void UConnectionPointComponent::OnRegister()
 {
-	if (!OtherPoint || OtherPoint == this)
+	Super::OnRegister();
+	
+	if (UConnectionPointRegistry* Registry = UConnectionPointRegistry::Get(GetWorld()))
 	{
-		return false;
+		Registry->RegisterPoint(this);
 	}
+}
 
-	// Check if either point is already occupied
-	if (bIsOccupied || OtherPoint->bIsOccupied)
+void UConnectionPointComponent::OnUnregister()
+{
+	if (UConnectionPointRegistry* Registry = UConnectionPointRegistry::Get(GetWorld()))
 	{
-		return false;
+		Registry->UnregisterPoint(this);
 	}
+	
+	Super::OnUnregister();
+}
 
-	// Check type compatibility
-	if (!AreTypesCompatible(ConnectionType, OtherPoint->ConnectionType))
+void UConnectionPointComponent::OnUpdateTransform(EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+	Super::OnUpdateTransform(UpdateTransformFlags, Teleport);
+	
+	if (IsRegistered())
+	{
+		if (UConnectionPointRegistry* Registry = UConnectionPointRegistry::Get(GetWorld()))
+		{
+			Registry->UpdatePoint(this);
+		}
+	}
+}
+
+bool UConnectionPointComponent::CanConnectTo(UConnectionPointComponent* OtherPoint) const
+{
+	if (!OtherPoint || OtherPoint == this)
 	{
 		return false;
 	}
 
-	// Check size compatibility
-	if (!AreSizesCompatible(ConnectionSize, OtherPoint->ConnectionSize))
+	// Check if either point is already occupied
+	if (bIsOccupied || OtherPoint->bIsOccupied)
 	{
 		return false;
 	}
 
-	return true;
+	// Check type and size compatibility with a single table lookup
+	return ConnectionCompatibility::AreCompatible(
+		ConnectionType, ConnectionSize,
+		OtherPoint->ConnectionType, OtherPoint->ConnectionSize);
 }
 
 bool UConnectionPointComponent::ConnectTo(UConnectionPointComponent* OtherPoint)
@@ -86,58 +115,3 @@ void UConnectionPointComponent::Disconnect()
 	bIsOccupied = false;
 	ConnectedModule = nullptr;
 }
-
-bool UConnectionPointComponent::AreTypesCompatible(EConnectionType TypeA, EConnectionType TypeB) const
-{
-	// Universal connections work with everything
-	if (TypeA == EConnectionType::Universal || TypeB == EConnectionType::Universal)
-	{
-		return true;
-	}
-
-	// Standard connections work with Standard and Corridor
-	if (TypeA == EConnectionType::Standard)
-	{
-		return (TypeB == EConnectionType::Standard || TypeB == EConnectionType::Corridor);
-	}
-
-	// Corridor connections work with everything except Docking
-	if (TypeA == EConnectionType::Corridor)
-	{
-		return (TypeB != EConnectionType::Docking);
-	}
-
-	// Docking connections cannot connect to other Docking connections
-	if (TypeA == EConnectionType::Docking)
-	{
-		return (TypeB != EConnectionType::Docking);
-	}
-
-	// Power connections only work with Power
-	if (TypeA == EConnectionType::Power)
-	{
-		return (TypeB == EConnectionType::Power);
-	}
-
-	// Same types can connect
-	return (TypeA == TypeB);
-}
-
-bool UConnectionPointComponent::AreSizesCompatible(EConnectionSize SizeA, EConnectionSize SizeB) const
-{
-	// Universal size works with everything
-	if (SizeA == EConnectionSize::Universal || SizeB == EConnectionSize::Universal)
-	{
-		return true;
-	}
-
-	// Same sizes are always compatible
-	if (SizeA == SizeB)
-	{
-		return true;
-	}
-
-	// Adjacent sizes are compatible (with warning)
-	int32 SizeDiff = FMath::Abs(static_cast<int32>(SizeA) - static_cast<int32>(SizeB));
-	return (SizeDiff == 1);
-}
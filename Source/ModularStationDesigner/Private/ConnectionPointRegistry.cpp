@@ -0,0 +1,163 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ConnectionPointRegistry.h"
+#include "ConnectionPoint.h"
+#include "Engine/World.h"
+
+UConnectionPointRegistry* UConnectionPointRegistry::Get(const UWorld* World)
+{
+	return World ? World->GetSubsystem<UConnectionPointRegistry>() : nullptr;
+}
+
+bool UConnectionPointRegistry::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	// The station designer viewport places modules in an editor preview world
+	return Super::DoesSupportWorldType(WorldType) || WorldType == EWorldType::EditorPreview;
+}
+
+void UConnectionPointRegistry::Deinitialize()
+{
+	Cells.Empty();
+	PointCells.Empty();
+
+	Super::Deinitialize();
+}
+
+void UConnectionPointRegistry::RegisterPoint(UConnectionPointComponent* Point)
+{
+	if (!Point || PointCells.Contains(Point))
+	{
+		return;
+	}
+
+	const FIntVector Cell = GetCellCoord(Point->GetComponentLocation());
+	Cells.FindOrAdd(Cell).Add(Point);
+	PointCells.Add(Point, Cell);
+}
+
+void UConnectionPointRegistry::UnregisterPoint(UConnectionPointComponent* Point)
+{
+	FIntVector Cell;
+	if (!PointCells.RemoveAndCopyValue(Point, Cell))
+	{
+		return;
+	}
+
+	if (TArray<UConnectionPointComponent*>* CellPoints = Cells.Find(Cell))
+	{
+		CellPoints->RemoveSingleSwap(Point);
+		if (CellPoints->Num() == 0)
+		{
+			Cells.Remove(Cell);
+		}
+	}
+}
+
+void UConnectionPointRegistry::UpdatePoint(UConnectionPointComponent* Point)
+{
+	FIntVector* CurrentCell = PointCells.Find(Point);
+	if (!CurrentCell)
+	{
+		RegisterPoint(Point);
+		return;
+	}
+
+	const FIntVector NewCell = GetCellCoord(Point->GetComponentLocation());
+	if (NewCell == *CurrentCell)
+	{
+		return;
+	}
+
+	// Move the point between cells
+	if (TArray<UConnectionPointComponent*>* OldCellPoints = Cells.Find(*CurrentCell))
+	{
+		OldCellPoints->RemoveSingleSwap(Point);
+		if (OldCellPoints->Num() == 0)
+		{
+			Cells.Remove(*CurrentCell);
+		}
+	}
+
+	Cells.FindOrAdd(NewCell).Add(Point);
+	*CurrentCell = NewCell;
+}
+
+void UConnectionPointRegistry::QueryRadius(
+	const FVector& WorldLocation,
+	float SearchRadius,
+	TArray<UConnectionPointComponent*>& OutPoints,
+	const AActor* IgnoreActor) const
+{
+	if (SearchRadius < 0.0f || Cells.Num() == 0)
+	{
+		return;
+	}
+
+	const float SearchRadiusSq = SearchRadius * SearchRadius;
+	const FIntVector MinCell = GetCellCoord(WorldLocation - FVector(SearchRadius));
+	const FIntVector MaxCell = GetCellCoord(WorldLocation + FVector(SearchRadius));
+
+	const int64 NumQueryCells =
+		int64(MaxCell.X - MinCell.X + 1) *
+		int64(MaxCell.Y - MinCell.Y + 1) *
+		int64(MaxCell.Z - MinCell.Z + 1);
+
+	// Very large radii cover more cells than are occupied, so walk the occupied cells instead
+	if (NumQueryCells > Cells.Num())
+	{
+		for (const auto& Pair : Cells)
+		{
+			const FIntVector& Cell = Pair.Key;
+			if (Cell.X >= MinCell.X && Cell.X <= MaxCell.X &&
+				Cell.Y >= MinCell.Y && Cell.Y <= MaxCell.Y &&
+				Cell.Z >= MinCell.Z && Cell.Z <= MaxCell.Z)
+			{
+				GatherFromCell(Pair.Value, WorldLocation, SearchRadiusSq, OutPoints, IgnoreActor);
+			}
+		}
+		return;
+	}
+
+	for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+	{
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+		{
+			for (int32 Z = MinCell.Z; Z <= MaxCell.Z; ++Z)
+			{
+				if (const TArray<UConnectionPointComponent*>* CellPoints = Cells.Find(FIntVector(X, Y, Z)))
+				{
+					GatherFromCell(*CellPoints, WorldLocation, SearchRadiusSq, OutPoints, IgnoreActor);
+				}
+			}
+		}
+	}
+}
+
+FIntVector UConnectionPointRegistry::GetCellCoord(const FVector& Location)
+{
+	return FIntVector(
+		FMath::FloorToInt32(Location.X / CellSize),
+		FMath::FloorToInt32(Location.Y / CellSize),
+		FMath::FloorToInt32(Location.Z / CellSize));
+}
+
+void UConnectionPointRegistry::GatherFromCell(
+	const TArray<UConnectionPointComponent*>& CellPoints,
+	const FVector& WorldLocation,
+	float SearchRadiusSq,
+	TArray<UConnectionPointComponent*>& OutPoints,
+	const AActor* IgnoreActor)
+{
+	for (UConnectionPointComponent* Point : CellPoints)
+	{
+		if (!Point || (IgnoreActor && Point->GetOwner() == IgnoreActor))
+		{
+			continue;
+		}
+
+		if (FVector::DistSquared(Point->GetComponentLocation(), WorldLocation) <= SearchRadiusSq)
+		{
+			OutPoints.Add(Point);
+		}
+	}
+}
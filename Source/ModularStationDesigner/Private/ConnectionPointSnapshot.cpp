@@ -0,0 +1,170 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ConnectionPointSnapshot.h"
+#include "ConnectionPoint.h"
+#include "ConnectionCompatibility.h"
+
+// Far enough away that padding lanes never pass a distance test, small enough that the square stays finite
+static constexpr float SnapshotPaddingCoordinate = 1.0e18f;
+
+void FConnectionPointSnapshot::Build(const TArray<UConnectionPointComponent*>& InPoints)
+{
+	Reset();
+
+	const int32 NumPoints = InPoints.Num();
+	const int32 PaddedNum = Align(NumPoints, LaneCount);
+
+	Points = InPoints;
+	X.SetNumUninitialized(PaddedNum);
+	Y.SetNumUninitialized(PaddedNum);
+	Z.SetNumUninitialized(PaddedNum);
+	Types.SetNumZeroed(PaddedNum);
+	Sizes.SetNumZeroed(PaddedNum);
+	Occupied.SetNumUninitialized(PaddedNum);
+	IndexByPoint.Reserve(NumPoints);
+
+	for (int32 i = 0; i < PaddedNum; ++i)
+	{
+		const UConnectionPointComponent* Point = i < NumPoints ? InPoints[i] : nullptr;
+		if (!Point)
+		{
+			X[i] = SnapshotPaddingCoordinate;
+			Y[i] = SnapshotPaddingCoordinate;
+			Z[i] = SnapshotPaddingCoordinate;
+			Occupied[i] = 1;
+			continue;
+		}
+
+		IndexByPoint.FindOrAdd(Point, i);
+
+		const FVector Location = Point->GetComponentLocation();
+		X[i] = static_cast<float>(Location.X);
+		Y[i] = static_cast<float>(Location.Y);
+		Z[i] = static_cast<float>(Location.Z);
+		Types[i] = static_cast<uint8>(Point->ConnectionType);
+		Sizes[i] = static_cast<uint8>(Point->ConnectionSize);
+		Occupied[i] = Point->bIsOccupied ? 1 : 0;
+	}
+}
+
+void FConnectionPointSnapshot::Reset()
+{
+	X.Reset();
+	Y.Reset();
+	Z.Reset();
+	Types.Reset();
+	Sizes.Reset();
+	Occupied.Reset();
+	Points.Reset();
+	IndexByPoint.Reset();
+}
+
+FORCEINLINE uint32 FConnectionPointSnapshot::IsCompatible(int32 Index, uint32 SourceMask) const
+{
+	const int32 Key = Types[Index] * ConnectionCompatibility::NumSizes + Sizes[Index];
+	return ((SourceMask >> Key) & 1u) & (Occupied[Index] ^ 1u);
+}
+
+int32 FConnectionPointSnapshot::FindNearest(const FVector& SourceLocation, uint32 SourceMask, float MaxDistanceSq, int32 ExcludeIndex) const
+{
+	const int32 PaddedNum = X.Num();
+	if (PaddedNum == 0 || SourceMask == 0)
+	{
+		return INDEX_NONE;
+	}
+
+	const VectorRegister4Float SourceX = VectorSetFloat1(static_cast<float>(SourceLocation.X));
+	const VectorRegister4Float SourceY = VectorSetFloat1(static_cast<float>(SourceLocation.Y));
+	const VectorRegister4Float SourceZ = VectorSetFloat1(static_cast<float>(SourceLocation.Z));
+
+	int32 NearestIndex = INDEX_NONE;
+	float NearestDistanceSq = MaxDistanceSq;
+	VectorRegister4Float NearestDistanceSqVec = VectorSetFloat1(NearestDistanceSq);
+
+	alignas(16) float LaneDistanceSq[LaneCount];
+
+	for (int32 Base = 0; Base < PaddedNum; Base += LaneCount)
+	{
+		// Squared distances for four candidates; kept as mul + add (no FMA) to match the scalar path bit for bit
+		const VectorRegister4Float DX = VectorSubtract(VectorLoad(&X[Base]), SourceX);
+		const VectorRegister4Float DY = VectorSubtract(VectorLoad(&Y[Base]), SourceY);
+		const VectorRegister4Float DZ = VectorSubtract(VectorLoad(&Z[Base]), SourceZ);
+		const VectorRegister4Float DistanceSq = VectorAdd(
+			VectorAdd(VectorMultiply(DX, DX), VectorMultiply(DY, DY)),
+			VectorMultiply(DZ, DZ));
+
+		uint32 LaneMask = static_cast<uint32>(VectorMaskBits(VectorCompareLT(DistanceSq, NearestDistanceSqVec)));
+		if (LaneMask == 0)
+		{
+			continue;
+		}
+
+		// Compatibility mask for the same four candidates
+		uint32 CompatibleMask = 0;
+		for (int32 Lane = 0; Lane < LaneCount; ++Lane)
+		{
+			CompatibleMask |= IsCompatible(Base + Lane, SourceMask) << Lane;
+		}
+		if (ExcludeIndex >= Base && ExcludeIndex < Base + LaneCount)
+		{
+			CompatibleMask &= ~(1u << (ExcludeIndex - Base));
+		}
+
+		LaneMask &= CompatibleMask;
+		if (LaneMask == 0)
+		{
+			continue;
+		}
+
+		// Resolve the surviving lanes in order so ties keep the earliest candidate, as the scalar path does
+		VectorStoreAligned(DistanceSq, LaneDistanceSq);
+		for (int32 Lane = 0; Lane < LaneCount; ++Lane)
+		{
+			if ((LaneMask & (1u << Lane)) && LaneDistanceSq[Lane] < NearestDistanceSq)
+			{
+				NearestDistanceSq = LaneDistanceSq[Lane];
+				NearestIndex = Base + Lane;
+			}
+		}
+		NearestDistanceSqVec = VectorSetFloat1(NearestDistanceSq);
+	}
+
+	return NearestIndex;
+}
+
+int32 FConnectionPointSnapshot::FindNearestScalar(const FVector& SourceLocation, uint32 SourceMask, float MaxDistanceSq, int32 ExcludeIndex) const
+{
+	const int32 PaddedNum = X.Num();
+	if (PaddedNum == 0 || SourceMask == 0)
+	{
+		return INDEX_NONE;
+	}
+
+	const float SourceX = static_cast<float>(SourceLocation.X);
+	const float SourceY = static_cast<float>(SourceLocation.Y);
+	const float SourceZ = static_cast<float>(SourceLocation.Z);
+
+	int32 NearestIndex = INDEX_NONE;
+	float NearestDistanceSq = MaxDistanceSq;
+
+	for (int32 i = 0; i < PaddedNum; ++i)
+	{
+		if (i == ExcludeIndex || !IsCompatible(i, SourceMask))
+		{
+			continue;
+		}
+
+		const float DX = X[i] - SourceX;
+		const float DY = Y[i] - SourceY;
+		const float DZ = Z[i] - SourceZ;
+		const float DistanceSq = (DX * DX + DY * DY) + DZ * DZ;
+
+		if (DistanceSq < NearestDistanceSq)
+		{
+			NearestDistanceSq = DistanceSq;
+			NearestIndex = i;
+		}
+	}
+
+	return NearestIndex;
+}
@@ -0,0 +1,144 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ConnectionPointSnapshot.h"
+#include "ConnectionPoint.h"
+#include "SnappingHelper.h"
+#include "ConnectionCompatibility.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "UObject/Package.h"
+#include "UObject/StrongObjectPtr.h"
+
+#if !UE_BUILD_SHIPPING
+
+namespace
+{
+	void RunSnapshotBenchmark(const TArray<FString>& Args)
+	{
+		int32 NumCandidates = 20000;
+		int32 NumQueries = 500;
+		if (Args.Num() > 0)
+		{
+			NumCandidates = FMath::Max(1, FCString::Atoi(*Args[0]));
+		}
+		if (Args.Num() > 1)
+		{
+			NumQueries = FMath::Max(1, FCString::Atoi(*Args[1]));
+		}
+
+		const float MaxSnapDistance = 500.0f;
+		const float WorldExtent = 20000.0f;
+		FRandomStream Random(4242);
+
+		// Transient, unregistered connection points; whole-centimetre positions keep float and double math comparable
+		TArray<TStrongObjectPtr<UConnectionPointComponent>> OwnedPoints;
+		TArray<UConnectionPointComponent*> Candidates;
+		OwnedPoints.Reserve(NumCandidates);
+		Candidates.Reserve(NumCandidates);
+
+		for (int32 i = 0; i < NumCandidates; ++i)
+		{
+			UConnectionPointComponent* Point = NewObject<UConnectionPointComponent>(GetTransientPackage());
+			Point->ConnectionType = static_cast<EConnectionType>(Random.RandRange(0, 4));
+			Point->ConnectionSize = static_cast<EConnectionSize>(Random.RandRange(0, 3));
+			Point->bIsOccupied = Random.FRand() < 0.1f;
+			Point->SetRelativeLocation(FVector(
+				FMath::RoundToFloat(Random.FRandRange(-WorldExtent, WorldExtent)),
+				FMath::RoundToFloat(Random.FRandRange(-WorldExtent, WorldExtent)),
+				FMath::RoundToFloat(Random.FRandRange(-WorldExtent, WorldExtent) * 0.1f)));
+			Point->UpdateComponentToWorld();
+
+			OwnedPoints.Emplace(Point);
+			Candidates.Add(Point);
+		}
+
+		TArray<UConnectionPointComponent*> Sources;
+		for (int32 i = 0; i < NumQueries; ++i)
+		{
+			Sources.Add(Candidates[Random.RandRange(0, NumCandidates - 1)]);
+		}
+
+		// Current implementation: UObject walk per candidate
+		TArray<UConnectionPointComponent*> ObjectResults;
+		const double ObjectStart = FPlatformTime::Seconds();
+		for (UConnectionPointComponent* Source : Sources)
+		{
+			ObjectResults.Add(FSnappingHelper::FindNearestConnectionPoint(Source, Candidates, MaxSnapDistance));
+		}
+		const double ObjectSeconds = FPlatformTime::Seconds() - ObjectStart;
+
+		// Snapshot build, paid once per drag
+		const double BuildStart = FPlatformTime::Seconds();
+		FConnectionPointSnapshot Snapshot;
+		Snapshot.Build(Candidates);
+		const double BuildSeconds = FPlatformTime::Seconds() - BuildStart;
+
+		// Scalar fallback over packed data
+		TArray<UConnectionPointComponent*> ScalarResults;
+		const double ScalarStart = FPlatformTime::Seconds();
+		for (UConnectionPointComponent* Source : Sources)
+		{
+			const int32 SourceIndex = Snapshot.IndexOf(Source);
+			const uint32 SourceMask = Source->bIsOccupied ? 0u : ConnectionCompatibility::GetCompatibilityMask(Source->ConnectionType, Source->ConnectionSize);
+			const int32 Index = Snapshot.FindNearestScalar(Source->GetComponentLocation(), SourceMask, MaxSnapDistance * MaxSnapDistance, SourceIndex);
+			ScalarResults.Add(Index != INDEX_NONE ? Snapshot.Points[Index] : nullptr);
+		}
+		const double ScalarSeconds = FPlatformTime::Seconds() - ScalarStart;
+
+		// Vectorized kernel
+		TArray<UConnectionPointComponent*> VectorResults;
+		const double VectorStart = FPlatformTime::Seconds();
+		for (UConnectionPointComponent* Source : Sources)
+		{
+			VectorResults.Add(FSnappingHelper::FindNearestConnectionPoint(Source, Snapshot, MaxSnapDistance));
+		}
+		const double VectorSeconds = FPlatformTime::Seconds() - VectorStart;
+
+		// Equivalence: scalar and vector paths must agree exactly; the UObject path uses double precision,
+		// so only count it as a mismatch when the chosen distances actually differ
+		int32 KernelMismatches = 0;
+		int32 ReferenceMismatches = 0;
+		for (int32 i = 0; i < Sources.Num(); ++i)
+		{
+			if (ScalarResults[i] != VectorResults[i])
+			{
+				++KernelMismatches;
+			}
+
+			if (ObjectResults[i] != VectorResults[i])
+			{
+				const FVector SourceLocation = Sources[i]->GetComponentLocation();
+				const double ObjectDistSq = ObjectResults[i] ? FVector::DistSquared(SourceLocation, ObjectResults[i]->GetComponentLocation()) : -1.0;
+				const double VectorDistSq = VectorResults[i] ? FVector::DistSquared(SourceLocation, VectorResults[i]->GetComponentLocation()) : -1.0;
+				if (!FMath::IsNearlyEqual(ObjectDistSq, VectorDistSq, 1.0))
+				{
+					++ReferenceMismatches;
+				}
+			}
+		}
+
+		UE_LOG(LogTemp, Display, TEXT("Connection point snapshot benchmark: %d candidates, %d queries"), NumCandidates, NumQueries);
+		UE_LOG(LogTemp, Display, TEXT("  UObject walk:    %.3f ms"), ObjectSeconds * 1000.0);
+		UE_LOG(LogTemp, Display, TEXT("  Snapshot build:  %.3f ms"), BuildSeconds * 1000.0);
+		UE_LOG(LogTemp, Display, TEXT("  Snapshot scalar: %.3f ms"), ScalarSeconds * 1000.0);
+		UE_LOG(LogTemp, Display, TEXT("  Snapshot vector: %.3f ms"), VectorSeconds * 1000.0);
+
+		if (KernelMismatches > 0 || ReferenceMismatches > 0)
+		{
+			UE_LOG(LogTemp, Error, TEXT("Snapshot kernel disagrees with reference (%d scalar/vector, %d UObject/vector mismatches)"),
+				KernelMismatches, ReferenceMismatches);
+		}
+		else
+		{
+			UE_LOG(LogTemp, Display, TEXT("  All %d queries match the current implementation"), NumQueries);
+		}
+	}
+
+	FAutoConsoleCommand BenchmarkSnapshotCommand(
+		TEXT("StationDesigner.BenchmarkSnapshotKernel"),
+		TEXT("Check and time the packed connection point kernel against FindNearestConnectionPoint. Usage: StationDesigner.BenchmarkSnapshotKernel [NumCandidates] [NumQueries]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&RunSnapshotBenchmark));
+}
+
+#endif // !UE_BUILD_SHIPPING
@@ -1,6 +1,9 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "SnappingHelper.h"
+#include "ConnectionPointRegistry.h"
+#include "ConnectionCompatibility.h"
+#include "ConnectionPointSnapshot.h"
 #include "Engine/World.h"
 #include "EngineUtils.h"
 
@@ -45,6 +48,133 @@ UConnectionPointComponent* FSnappingHelper::FindNearestConnectionPoint(
 	return NearestPoint;
 }
 
+UConnectionPointComponent* FSnappingHelper::FindNearestConnectionPoint(
+	UConnectionPointComponent* SourcePoint,
+	const FConnectionPointSnapshot& Snapshot,
+	float MaxSnapDistance)
+{
+	if (!SourcePoint || SourcePoint->bIsOccupied)
+	{
+		return nullptr;
+	}
+	
+	const uint32 SourceMask = ConnectionCompatibility::GetCompatibilityMask(
+		SourcePoint->ConnectionType, SourcePoint->ConnectionSize);
+	const int32 SourceIndex = Snapshot.IndexOf(SourcePoint);
+	
+	const int32 NearestIndex = Snapshot.FindNearest(
+		SourcePoint->GetComponentLocation(),
+		SourceMask,
+		MaxSnapDistance * MaxSnapDistance,
+		SourceIndex);
+	
+	return NearestIndex != INDEX_NONE ? Snapshot.Points[NearestIndex] : nullptr;
+}
+
+TArray<FSnapPair> FSnappingHelper::FindBestSnapPairs(
+	const TArray<UConnectionPointComponent*>& SourcePoints,
+	UWorld* World,
+	float MaxSnapDistance)
+{
+	TArray<FSnapPair> SnapPairs;
+	
+	if (!World || SourcePoints.Num() == 0)
+	{
+		return SnapPairs;
+	}
+	
+	// Targets on any module of the moving selection are not valid snap targets
+	TSet<const AActor*> MovingActors;
+	for (const UConnectionPointComponent* SourcePoint : SourcePoints)
+	{
+		if (SourcePoint)
+		{
+			MovingActors.Add(SourcePoint->GetOwner());
+		}
+	}
+	
+	const UConnectionPointRegistry* Registry = UConnectionPointRegistry::Get(World);
+	const float MaxSnapDistanceSq = MaxSnapDistance * MaxSnapDistance;
+	
+	// Gather every compatible (source, target) candidate within range
+	TArray<FSnapPair> Candidates;
+	TArray<UConnectionPointComponent*> NearbyPoints;
+	TSet<const UConnectionPointComponent*> VisitedSources;
+	
+	for (UConnectionPointComponent* SourcePoint : SourcePoints)
+	{
+		if (!SourcePoint || SourcePoint->bIsOccupied)
+		{
+			continue;
+		}
+		
+		bool bAlreadyVisited = false;
+		VisitedSources.Add(SourcePoint, &bAlreadyVisited);
+		if (bAlreadyVisited)
+		{
+			continue;
+		}
+		
+		const uint32 SourceMask = ConnectionCompatibility::GetCompatibilityMask(
+			SourcePoint->ConnectionType, SourcePoint->ConnectionSize);
+		const FVector SourceLocation = SourcePoint->GetComponentLocation();
+		
+		NearbyPoints.Reset();
+		if (Registry)
+		{
+			Registry->QueryRadius(SourceLocation, MaxSnapDistance, NearbyPoints);
+		}
+		else
+		{
+			NearbyPoints = FindConnectionPointsInRadius(SourceLocation, MaxSnapDistance, World);
+		}
+		
+		for (UConnectionPointComponent* TargetPoint : NearbyPoints)
+		{
+			if (!TargetPoint || TargetPoint->bIsOccupied || MovingActors.Contains(TargetPoint->GetOwner()))
+			{
+				continue;
+			}
+			
+			const uint32 TargetBit = ConnectionCompatibility::GetKeyBit(
+				TargetPoint->ConnectionType, TargetPoint->ConnectionSize);
+			if ((SourceMask & TargetBit) == 0)
+			{
+				continue;
+			}
+			
+			const float DistanceSq = FVector::DistSquared(SourceLocation, TargetPoint->GetComponentLocation());
+			if (DistanceSq <= MaxSnapDistanceSq)
+			{
+				Candidates.Emplace(SourcePoint, TargetPoint, DistanceSq);
+			}
+		}
+	}
+	
+	// Resolve one-to-one assignments greedily, closest pairs first
+	Candidates.StableSort([](const FSnapPair& A, const FSnapPair& B)
+	{
+		return A.DistanceSq < B.DistanceSq;
+	});
+	
+	TSet<const UConnectionPointComponent*> ClaimedSources;
+	TSet<const UConnectionPointComponent*> ClaimedTargets;
+	
+	for (const FSnapPair& Candidate : Candidates)
+	{
+		if (ClaimedSources.Contains(Candidate.SourcePoint) || ClaimedTargets.Contains(Candidate.TargetPoint))
+		{
+			continue;
+		}
+		
+		ClaimedSources.Add(Candidate.SourcePoint);
+		ClaimedTargets.Add(Candidate.TargetPoint);
+		SnapPairs.Add(Candidate);
+	}
+	
+	return SnapPairs;
+}
+
 FTransform FSnappingHelper::CalculateSnapTransform(
 	UConnectionPointComponent* SourcePoint,
 	UConnectionPointComponent* TargetPoint)
@@ -130,11 +260,14 @@ TArray<UConnectionPointComponent*> FSnappingHelper::FindConnectionPointsInRadius
 		return FoundPoints;
 	}
 	
-	// TODO: Performance optimization - TActorIterator can be expensive in large levels.
-	// Consider maintaining a spatial data structure (e.g., octree) or registry of modules
-	// with connection points for better performance during placement operations.
+	// Query the world's spatial registry so only nearby grid cells are visited
+	if (const UConnectionPointRegistry* Registry = UConnectionPointRegistry::Get(World))
+	{
+		Registry->QueryRadius(WorldLocation, SearchRadius, FoundPoints, IgnoreActor);
+		return FoundPoints;
+	}
 	
-	// Iterate through all actors with connection points
+	// Fallback for world types without a registry: iterate through all actors with connection points
 	for (TActorIterator<AActor> It(World); It; ++It)
 	{
 		AActor* Actor = *It;
@@ -0,0 +1,163 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "StationConnectivityTracker.h"
+
+FStationConnectivityTracker::FStationConnectivityTracker()
+	: NumComponents(0)
+	, NumTrackedModules(0)
+	, bDirty(true)
+{
+}
+
+void FStationConnectivityTracker::Rebuild(const FStationDesign& Design)
+{
+	HandleByID.Reset();
+	Parent.Reset();
+	ComponentSize.Reset();
+	NumComponents = 0;
+	NumTrackedModules = 0;
+
+	HandleByID.Reserve(Design.Modules.Num());
+	Parent.Reserve(Design.Modules.Num());
+	ComponentSize.Reserve(Design.Modules.Num());
+
+	for (const FModulePlacement& Module : Design.Modules)
+	{
+		AddHandle(Module.ModuleID);
+	}
+
+	for (const FModulePlacement& Module : Design.Modules)
+	{
+		const int32 Handle = HandleByID.FindChecked(Module.ModuleID);
+		for (const FString& ConnectedID : Module.ConnectedModuleIDs)
+		{
+			if (const int32* ConnectedHandle = HandleByID.Find(ConnectedID))
+			{
+				Union(Handle, *ConnectedHandle);
+			}
+		}
+	}
+
+	NumTrackedModules = Design.Modules.Num();
+	bDirty = false;
+}
+
+void FStationConnectivityTracker::Refresh(const FStationDesign& Design)
+{
+	if (bDirty || NumTrackedModules != Design.Modules.Num())
+	{
+		Rebuild(Design);
+	}
+}
+
+void FStationConnectivityTracker::OnModuleAdded(const FModulePlacement& Module)
+{
+	++NumTrackedModules;
+
+	if (bDirty)
+	{
+		return;
+	}
+
+	if (HandleByID.Contains(Module.ModuleID))
+	{
+		// Duplicate ID: the design keeps both entries, let a rebuild sort it out
+		bDirty = true;
+		return;
+	}
+
+	const int32 Handle = AddHandle(Module.ModuleID);
+	for (const FString& ConnectedID : Module.ConnectedModuleIDs)
+	{
+		if (const int32* ConnectedHandle = HandleByID.Find(ConnectedID))
+		{
+			Union(Handle, *ConnectedHandle);
+		}
+	}
+}
+
+void FStationConnectivityTracker::OnModuleRemoved(const FString& ModuleID)
+{
+	--NumTrackedModules;
+	bDirty = true;
+}
+
+void FStationConnectivityTracker::OnModulesConnected(const FString& ModuleAID, const FString& ModuleBID)
+{
+	if (bDirty)
+	{
+		return;
+	}
+
+	const int32* HandleA = HandleByID.Find(ModuleAID);
+	const int32* HandleB = HandleByID.Find(ModuleBID);
+	if (HandleA && HandleB)
+	{
+		Union(*HandleA, *HandleB);
+	}
+}
+
+void FStationConnectivityTracker::OnModulesDisconnected(const FString& ModuleAID, const FString& ModuleBID)
+{
+	bDirty = true;
+}
+
+bool FStationConnectivityTracker::AreConnected(const FString& ModuleAID, const FString& ModuleBID)
+{
+	check(!bDirty);
+
+	const int32* HandleA = HandleByID.Find(ModuleAID);
+	const int32* HandleB = HandleByID.Find(ModuleBID);
+	return HandleA && HandleB && FindRoot(*HandleA) == FindRoot(*HandleB);
+}
+
+int32 FStationConnectivityTracker::GetComponentSize(const FString& ModuleID)
+{
+	check(!bDirty);
+
+	const int32* Handle = HandleByID.Find(ModuleID);
+	return Handle ? ComponentSize[FindRoot(*Handle)] : 0;
+}
+
+int32 FStationConnectivityTracker::AddHandle(const FString& ModuleID)
+{
+	if (const int32* Existing = HandleByID.Find(ModuleID))
+	{
+		return *Existing; // First module wins on duplicate IDs, matching FStationDesign
+	}
+
+	const int32 Handle = Parent.Add(Parent.Num());
+	ComponentSize.Add(1);
+	HandleByID.Add(ModuleID, Handle);
+	++NumComponents;
+	return Handle;
+}
+
+int32 FStationConnectivityTracker::FindRoot(int32 Handle)
+{
+	while (Parent[Handle] != Handle)
+	{
+		Parent[Handle] = Parent[Parent[Handle]];
+		Handle = Parent[Handle];
+	}
+	return Handle;
+}
+
+void FStationConnectivityTracker::Union(int32 HandleA, int32 HandleB)
+{
+	int32 RootA = FindRoot(HandleA);
+	int32 RootB = FindRoot(HandleB);
+	if (RootA == RootB)
+	{
+		return;
+	}
+
+	if (ComponentSize[RootA] < ComponentSize[RootB])
+	{
+		Swap(RootA, RootB);
+	}
+
+	Parent[RootB] = RootA;
+	ComponentSize[RootA] += ComponentSize[RootB];
+	--NumComponents;
+}
@@ -0,0 +1,211 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "StationDesignerTypes.h"
+#include "StationModuleGraph.h"
+
+uint64 FStationDesign::AllocateRevision()
+{
+	static TAtomic<uint64> RevisionCounter(0);
+	return ++RevisionCounter;
+}
+
+int32 FStationDesign::FindModuleIndex(const FString& InModuleID) const
+{
+	EnsureModuleIndex();
+
+	const int32* FoundIndex = ModuleIndexMap.Find(InModuleID);
+	if (FoundIndex && Modules.IsValidIndex(*FoundIndex) && Modules[*FoundIndex].ModuleID == InModuleID)
+	{
+		return *FoundIndex;
+	}
+
+	if (!FoundIndex && IndexedRevision == Revision)
+	{
+		return INDEX_NONE; // Lookup is current, the ID really is absent
+	}
+
+	// Modules were reordered, replaced or renamed in place; resynchronize and retry once
+	SyncModuleIndex();
+	FoundIndex = ModuleIndexMap.Find(InModuleID);
+	return FoundIndex ? *FoundIndex : INDEX_NONE;
+}
+
+FModulePlacement* FStationDesign::FindModule(const FString& InModuleID)
+{
+	const int32 Index = FindModuleIndex(InModuleID);
+	return Index != INDEX_NONE ? &Modules[Index] : nullptr;
+}
+
+const FModulePlacement* FStationDesign::FindModule(const FString& InModuleID) const
+{
+	const int32 Index = FindModuleIndex(InModuleID);
+	return Index != INDEX_NONE ? &Modules[Index] : nullptr;
+}
+
+int32 FStationDesign::AddModule(const FModulePlacement& Module)
+{
+	EnsureModuleIndex();
+
+	const int32 Index = Modules.Add(Module);
+
+	// Keep the first module on duplicate IDs, matching a front-to-back scan
+	if (!ModuleIndexMap.Contains(Module.ModuleID))
+	{
+		ModuleIndexMap.Add(Module.ModuleID, Index);
+	}
+	IndexedModuleCount = Modules.Num();
+	MarkModifiedKeepingIndex();
+
+	return Index;
+}
+
+int32 FStationDesign::InsertModule(int32 Index, const FModulePlacement& Module)
+{
+	EnsureModuleIndex();
+
+	Index = FMath::Clamp(Index, 0, Modules.Num());
+	Modules.Insert(Module, Index);
+
+	for (TPair<FString, int32>& Entry : ModuleIndexMap)
+	{
+		if (Entry.Value >= Index)
+		{
+			++Entry.Value;
+		}
+	}
+
+	// The inserted module becomes the lookup target if it now precedes an existing duplicate
+	int32* ExistingIndex = ModuleIndexMap.Find(Module.ModuleID);
+	if (!ExistingIndex)
+	{
+		ModuleIndexMap.Add(Module.ModuleID, Index);
+	}
+	else if (*ExistingIndex > Index)
+	{
+		*ExistingIndex = Index;
+	}
+	IndexedModuleCount = Modules.Num();
+	MarkModifiedKeepingIndex();
+
+	return Index;
+}
+
+bool FStationDesign::RemoveModule(const FString& InModuleID, FModulePlacement* OutRemovedModule)
+{
+	const int32 Index = FindModuleIndex(InModuleID);
+	if (Index == INDEX_NONE)
+	{
+		return false;
+	}
+
+	if (OutRemovedModule)
+	{
+		*OutRemovedModule = Modules[Index];
+	}
+
+	RemoveModuleAt(Index);
+	return true;
+}
+
+void FStationDesign::RemoveModuleAt(int32 Index)
+{
+	if (!Modules.IsValidIndex(Index))
+	{
+		return;
+	}
+
+	EnsureModuleIndex();
+
+	const FString RemovedID = Modules[Index].ModuleID;
+
+	// Order-preserving: saved files, the content hash and undo all depend on module order
+	Modules.RemoveAt(Index);
+
+	for (TPair<FString, int32>& Entry : ModuleIndexMap)
+	{
+		if (Entry.Value > Index)
+		{
+			--Entry.Value;
+		}
+	}
+
+	// Hand the removed ID to the next duplicate, if any, so lookups still match a front-to-back scan
+	if (ModuleIndexMap.FindRef(RemovedID, INDEX_NONE) == Index)
+	{
+		ModuleIndexMap.Remove(RemovedID);
+		for (int32 DuplicateIndex = Index; DuplicateIndex < Modules.Num(); ++DuplicateIndex)
+		{
+			if (Modules[DuplicateIndex].ModuleID == RemovedID)
+			{
+				ModuleIndexMap.Add(RemovedID, DuplicateIndex);
+				break;
+			}
+		}
+	}
+
+	IndexedModuleCount = Modules.Num();
+	MarkModifiedKeepingIndex();
+}
+
+void FStationDesign::EmptyModules()
+{
+	Modules.Empty();
+	ModuleIndexMap.Empty();
+	IndexedModuleCount = 0;
+	MarkModified();
+	IndexedRevision = Revision;
+}
+
+void FStationDesign::RebuildModuleIndex() const
+{
+	SyncModuleIndex();
+	MarkModified();
+	IndexedRevision = Revision;
+}
+
+void FStationDesign::SyncModuleIndex() const
+{
+	ModuleIndexMap.Reset();
+	ModuleIndexMap.Reserve(Modules.Num());
+
+	for (int32 Index = 0; Index < Modules.Num(); ++Index)
+	{
+		if (!ModuleIndexMap.Contains(Modules[Index].ModuleID))
+		{
+			ModuleIndexMap.Add(Modules[Index].ModuleID, Index);
+		}
+	}
+
+	IndexedModuleCount = Modules.Num();
+	IndexedRevision = Revision;
+}
+
+void FStationDesign::MarkModifiedKeepingIndex() const
+{
+	// Only a lookup that was current before this edit is current after it
+	const bool bIndexWasCurrent = IndexedRevision == Revision;
+	MarkModified();
+	if (bIndexWasCurrent)
+	{
+		IndexedRevision = Revision;
+	}
+}
+
+void FStationDesign::EnsureModuleIndex() const
+{
+	if (IndexedModuleCount != Modules.Num())
+	{
+		SyncModuleIndex();
+	}
+}
+
+const FStationModuleGraph& FStationDesign::GetModuleGraph() const
+{
+	if (!ModuleGraph.IsValid() || ModuleGraphRevision != Revision)
+	{
+		// Replace rather than rebuild in place, copies of the design may still hold the old graph
+		ModuleGraph = MakeShared<FStationModuleGraph, ESPMode::ThreadSafe>(*this);
+		ModuleGraphRevision = Revision;
+	}
+	return *ModuleGraph;
+}
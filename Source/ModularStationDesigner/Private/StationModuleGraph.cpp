@@ -0,0 +1,148 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "StationModuleGraph.h"
+
+FStationModuleGraph::FStationModuleGraph(const FStationDesign& Design)
+{
+	Build(Design);
+}
+
+void FStationModuleGraph::Build(const FStationDesign& Design)
+{
+	const int32 Num = Design.Modules.Num();
+
+	int32 TotalConnections = 0;
+	for (const FModulePlacement& Module : Design.Modules)
+	{
+		TotalConnections += Module.ConnectedModuleIDs.Num();
+	}
+
+	Offsets.Reset(Num + 1);
+	Neighbors.Reset(TotalConnections);
+
+	for (const FModulePlacement& Module : Design.Modules)
+	{
+		const int32 RowStart = Neighbors.Num();
+		Offsets.Add(RowStart);
+
+		for (const FString& ConnectedID : Module.ConnectedModuleIDs)
+		{
+			const int32 NeighborHandle = Design.FindModuleIndex(ConnectedID);
+			if (NeighborHandle == INDEX_NONE)
+			{
+				continue; // Dangling connection to a removed module
+			}
+
+			// Rows are short, so a linear duplicate check beats hashing
+			bool bDuplicate = false;
+			for (int32 i = RowStart; i < Neighbors.Num(); ++i)
+			{
+				if (Neighbors[i] == NeighborHandle)
+				{
+					bDuplicate = true;
+					break;
+				}
+			}
+
+			if (!bDuplicate)
+			{
+				Neighbors.Add(NeighborHandle);
+			}
+		}
+	}
+
+	Offsets.Add(Neighbors.Num());
+}
+
+void FStationModuleGraph::Reset()
+{
+	Offsets.Reset();
+	Neighbors.Reset();
+}
+
+int32 FStationModuleGraph::FindReachable(int32 RootHandle, TBitArray<>& OutReachable) const
+{
+	OutReachable.Init(false, NumModules());
+
+	if (!IsValidHandle(RootHandle))
+	{
+		return 0;
+	}
+
+	TArray<int32> Queue;
+	Queue.Reserve(NumModules());
+	Queue.Add(RootHandle);
+	OutReachable[RootHandle] = true;
+
+	int32 QueueIndex = 0;
+	while (QueueIndex < Queue.Num())
+	{
+		const int32 Current = Queue[QueueIndex++];
+
+		for (int32 i = Offsets[Current]; i < Offsets[Current + 1]; ++i)
+		{
+			const int32 Neighbor = Neighbors[i];
+			if (!OutReachable[Neighbor])
+			{
+				OutReachable[Neighbor] = true;
+				Queue.Add(Neighbor);
+			}
+		}
+	}
+
+	return Queue.Num();
+}
+
+int32 FStationModuleGraph::FindConnected(int32 RootHandle, TBitArray<>& OutConnected) const
+{
+	OutConnected.Init(false, NumModules());
+
+	if (!IsValidHandle(RootHandle))
+	{
+		return 0;
+	}
+
+	// Rows only hold outgoing links, so union every edge instead of walking them
+	TArray<int32> Parent;
+	Parent.SetNumUninitialized(NumModules());
+	for (int32 Handle = 0; Handle < NumModules(); ++Handle)
+	{
+		Parent[Handle] = Handle;
+	}
+
+	auto FindRoot = [&Parent](int32 Handle)
+	{
+		while (Parent[Handle] != Handle)
+		{
+			Parent[Handle] = Parent[Parent[Handle]];
+			Handle = Parent[Handle];
+		}
+		return Handle;
+	};
+
+	for (int32 Handle = 0; Handle < NumModules(); ++Handle)
+	{
+		for (int32 i = Offsets[Handle]; i < Offsets[Handle + 1]; ++i)
+		{
+			const int32 RootA = FindRoot(Handle);
+			const int32 RootB = FindRoot(Neighbors[i]);
+			if (RootA != RootB)
+			{
+				Parent[RootB] = RootA;
+			}
+		}
+	}
+
+	const int32 Root = FindRoot(RootHandle);
+	int32 NumConnected = 0;
+	for (int32 Handle = 0; Handle < NumModules(); ++Handle)
+	{
+		if (FindRoot(Handle) == Root)
+		{
+			OutConnected[Handle] = true;
+			++NumConnected;
+		}
+	}
+
+	return NumConnected;
+}
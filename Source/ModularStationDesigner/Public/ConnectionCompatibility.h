@@ -0,0 +1,100 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "StationDesignerTypes.h"
+
+/**
+ * Precomputed connection compatibility rules
+ * 
+ * Every (type, size) pair is folded into a key in [0, NumKeys). Each key owns a
+ * bitmask with one bit per key it can connect to, so checking a candidate is a
+ * single AND: (GetCompatibilityMask(Source) & GetKeyBit(Target)) != 0
+ * 
+ * Rules are directional: the row is the source point, the column the target point.
+ */
+namespace ConnectionCompatibility
+{
+	inline constexpr int32 NumTypes = 5;
+	inline constexpr int32 NumSizes = 4;
+	inline constexpr int32 NumKeys = NumTypes * NumSizes;
+
+	static_assert(static_cast<int32>(EConnectionType::Universal) == NumTypes - 1, "Update the type table when EConnectionType changes");
+	static_assert(static_cast<int32>(EConnectionSize::Universal) == NumSizes - 1, "Update the size table when EConnectionSize changes");
+	static_assert(NumKeys <= 32, "Compatibility masks must fit in 32 bits");
+
+	/** Type compatibility, indexed [source][target] in EConnectionType order */
+	inline constexpr bool TypeTable[NumTypes][NumTypes] =
+	{
+		//              Standard  Docking  Corridor  Power  Universal
+		/* Standard  */ { true,    false,   true,     false, true },
+		/* Docking   */ { true,    false,   true,     true,  true },
+		/* Corridor  */ { true,    false,   true,     true,  true },
+		/* Power     */ { false,   false,   false,    true,  true },
+		/* Universal */ { true,    true,    true,     true,  true },
+	};
+
+	/** Size compatibility, indexed [source][target] in EConnectionSize order (adjacent sizes connect) */
+	inline constexpr bool SizeTable[NumSizes][NumSizes] =
+	{
+		//              Small  Medium  Large  Universal
+		/* Small     */ { true,  true,   false, true },
+		/* Medium    */ { true,  true,   true,  true },
+		/* Large     */ { false, true,   true,  true },
+		/* Universal */ { true,  true,   true,  true },
+	};
+
+	/** Dense key for a (type, size) pair */
+	constexpr int32 GetKey(EConnectionType Type, EConnectionSize Size)
+	{
+		return static_cast<int32>(Type) * NumSizes + static_cast<int32>(Size);
+	}
+
+	/** Single bit identifying a (type, size) pair as a connection target */
+	constexpr uint32 GetKeyBit(EConnectionType Type, EConnectionSize Size)
+	{
+		return 1u << GetKey(Type, Size);
+	}
+
+	namespace Private
+	{
+		struct FMaskTable
+		{
+			uint32 Masks[NumKeys] = {};
+		};
+
+		constexpr FMaskTable BuildMaskTable()
+		{
+			FMaskTable Table;
+			for (int32 SourceKey = 0; SourceKey < NumKeys; ++SourceKey)
+			{
+				for (int32 TargetKey = 0; TargetKey < NumKeys; ++TargetKey)
+				{
+					const bool bTypesMatch = TypeTable[SourceKey / NumSizes][TargetKey / NumSizes];
+					const bool bSizesMatch = SizeTable[SourceKey % NumSizes][TargetKey % NumSizes];
+					if (bTypesMatch && bSizesMatch)
+					{
+						Table.Masks[SourceKey] |= 1u << TargetKey;
+					}
+				}
+			}
+			return Table;
+		}
+	}
+
+	/** Compatibility bitmask per source key */
+	inline constexpr Private::FMaskTable MaskTable = Private::BuildMaskTable();
+
+	/** Bitmask of every (type, size) key a source point can connect to */
+	constexpr uint32 GetCompatibilityMask(EConnectionType Type, EConnectionSize Size)
+	{
+		return MaskTable.Masks[GetKey(Type, Size)];
+	}
+
+	/** Check type and size compatibility of a source against a target */
+	constexpr bool AreCompatible(EConnectionType SourceType, EConnectionSize SourceSize, EConnectionType TargetType, EConnectionSize TargetSize)
+	{
+		return (GetCompatibilityMask(SourceType, SourceSize) & GetKeyBit(TargetType, TargetSize)) != 0;
+	}
+}
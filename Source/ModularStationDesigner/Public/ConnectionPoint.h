@@ -49,10 +49,8 @@ public:
 protected:
 	virtual void BeginPlay() override;
 	
-private:
-	// Helper method to check type compatibility
-	bool AreTypesCompatible(EConnectionType TypeA, EConnectionType TypeB) const;
-	
-	// Helper method to check size compatibility
-	bool AreSizesCompatible(EConnectionSize SizeA, EConnectionSize SizeB) const;
+	// Keep the world's connection point registry in sync with this component
+	virtual void OnRegister() override;
+	virtual void OnUnregister() override;
+	virtual void OnUpdateTransform(EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport = ETeleportType::None) override;
 };
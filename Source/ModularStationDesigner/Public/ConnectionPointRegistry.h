@@ -0,0 +1,81 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ConnectionPointRegistry.generated.h"
+
+class UConnectionPointComponent;
+
+/**
+ * World-scoped registry of connection points
+ * Buckets every registered UConnectionPointComponent into a uniform grid so that
+ * radius queries only visit the cells overlapping the search sphere
+ */
+UCLASS()
+class MODULARSTATIONDESIGNER_API UConnectionPointRegistry : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Edge length of a grid cell (in cm) */
+	static constexpr float CellSize = 1000.0f;
+
+	/**
+	 * Get the registry for a world
+	 * @param World World context
+	 * @return The registry, or nullptr if the world type is not supported
+	 */
+	static UConnectionPointRegistry* Get(const UWorld* World);
+
+	/** Add a connection point at its current world location */
+	void RegisterPoint(UConnectionPointComponent* Point);
+
+	/** Remove a connection point from the grid */
+	void UnregisterPoint(UConnectionPointComponent* Point);
+
+	/** Move a connection point to the cell matching its current world location */
+	void UpdatePoint(UConnectionPointComponent* Point);
+
+	/**
+	 * Find all registered connection points within a radius
+	 * @param WorldLocation Center of search sphere
+	 * @param SearchRadius Radius to search within
+	 * @param OutPoints Receives the points found (appended)
+	 * @param IgnoreActor Actor whose points are skipped
+	 */
+	void QueryRadius(
+		const FVector& WorldLocation,
+		float SearchRadius,
+		TArray<UConnectionPointComponent*>& OutPoints,
+		const AActor* IgnoreActor = nullptr) const;
+
+	/** Number of connection points currently registered */
+	int32 GetNumRegisteredPoints() const { return PointCells.Num(); }
+
+	// USubsystem interface
+	virtual void Deinitialize() override;
+
+protected:
+	// UWorldSubsystem interface
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/** Grid cell containing a world location */
+	static FIntVector GetCellCoord(const FVector& Location);
+
+	/** Append the points of one cell that fall inside the search sphere */
+	static void GatherFromCell(
+		const TArray<UConnectionPointComponent*>& CellPoints,
+		const FVector& WorldLocation,
+		float SearchRadiusSq,
+		TArray<UConnectionPointComponent*>& OutPoints,
+		const AActor* IgnoreActor);
+
+	/** Occupied grid cells */
+	TMap<FIntVector, TArray<UConnectionPointComponent*>> Cells;
+
+	/** Cell each registered point currently lives in */
+	TMap<UConnectionPointComponent*, FIntVector> PointCells;
+};
@@ -0,0 +1,73 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UConnectionPointComponent;
+
+/**
+ * Packed structure-of-arrays copy of connection point state
+ * Built once per drag so per-candidate distance and compatibility tests never chase
+ * UObject pointers. Positions are stored as contiguous float arrays padded to a multiple
+ * of the SIMD width; padding lanes are flagged occupied so they never match.
+ * 
+ * The snapshot does not track later changes to the source components (moves or
+ * occupancy); rebuild it when the candidate set changes.
+ */
+struct MODULARSTATIONDESIGNER_API FConnectionPointSnapshot
+{
+	/** Candidates processed per vector instruction */
+	static constexpr int32 LaneCount = 4;
+
+	/** World positions (in cm) */
+	TArray<float> X;
+	TArray<float> Y;
+	TArray<float> Z;
+
+	/** EConnectionType / EConnectionSize values */
+	TArray<uint8> Types;
+	TArray<uint8> Sizes;
+
+	/** Non-zero if the point cannot accept a connection (occupied, null or padding) */
+	TArray<uint8> Occupied;
+
+	/** Source components, index-aligned with the packed arrays */
+	TArray<UConnectionPointComponent*> Points;
+
+	/** Capture the current state of a set of connection points */
+	void Build(const TArray<UConnectionPointComponent*>& InPoints);
+
+	/** Release all packed data */
+	void Reset();
+
+	/** Number of captured points (excluding padding) */
+	int32 Num() const { return Points.Num(); }
+
+	/** Index of a captured point, or INDEX_NONE (hash lookup, no scan) */
+	int32 IndexOf(const UConnectionPointComponent* Point) const
+	{
+		const int32* Index = IndexByPoint.Find(Point);
+		return Index ? *Index : INDEX_NONE;
+	}
+
+	/**
+	 * Find the nearest compatible point using the vectorized kernel
+	 * @param SourceLocation World location of the source point
+	 * @param SourceMask Compatibility mask of the source (see ConnectionCompatibility)
+	 * @param MaxDistanceSq Candidates must be strictly closer than this squared distance
+	 * @param ExcludeIndex Index to skip (e.g. the source itself), or INDEX_NONE
+	 * @return Index of the nearest compatible point, or INDEX_NONE
+	 */
+	int32 FindNearest(const FVector& SourceLocation, uint32 SourceMask, float MaxDistanceSq, int32 ExcludeIndex = INDEX_NONE) const;
+
+	/** Scalar reference implementation of FindNearest, returns identical results */
+	int32 FindNearestScalar(const FVector& SourceLocation, uint32 SourceMask, float MaxDistanceSq, int32 ExcludeIndex = INDEX_NONE) const;
+
+private:
+	/** Source component -> packed index, first occurrence wins */
+	TMap<const UConnectionPointComponent*, int32> IndexByPoint;
+
+	/** Bit set if the candidate's (type, size) key is present in the source mask and it is free */
+	FORCEINLINE uint32 IsCompatible(int32 Index, uint32 SourceMask) const;
+};
@@ -5,6 +5,32 @@
 #include "CoreMinimal.h"
 #include "ConnectionPoint.h"
 
+struct FConnectionPointSnapshot;
+
+/**
+ * A resolved snap between a connection point on a moving module and a stationary target
+ */
+struct FSnapPair
+{
+	UConnectionPointComponent* SourcePoint;
+	UConnectionPointComponent* TargetPoint;
+	float DistanceSq;
+
+	FSnapPair()
+		: SourcePoint(nullptr)
+		, TargetPoint(nullptr)
+		, DistanceSq(0.0f)
+	{
+	}
+
+	FSnapPair(UConnectionPointComponent* InSourcePoint, UConnectionPointComponent* InTargetPoint, float InDistanceSq)
+		: SourcePoint(InSourcePoint)
+		, TargetPoint(InTargetPoint)
+		, DistanceSq(InDistanceSq)
+	{
+	}
+};
+
 /**
  * Helper utilities for module snapping and connection
  * Provides algorithms for finding nearby connection points and calculating snap transforms
@@ -24,6 +50,34 @@ public:
 		const TArray<UConnectionPointComponent*>& PotentialTargets,
 		float MaxSnapDistance = 100.0f);
 	
+	/**
+	 * Find the nearest connection point within snap distance using a packed snapshot
+	 * Build the snapshot once per drag; this runs the vectorized kernel without touching UObjects
+	 * @param SourcePoint The connection point to snap from
+	 * @param Snapshot Packed potential targets
+	 * @param MaxSnapDistance Maximum distance for snapping (in cm)
+	 * @return The nearest compatible connection point, or nullptr if none found
+	 */
+	static UConnectionPointComponent* FindNearestConnectionPoint(
+		UConnectionPointComponent* SourcePoint,
+		const FConnectionPointSnapshot& Snapshot,
+		float MaxSnapDistance = 100.0f);
+	
+	/**
+	 * Find the best set of snaps for a moving multi-module selection in one pass
+	 * Candidates come from the world's connection point registry and are pruned with the
+	 * compatibility bitmasks. Pairs are assigned closest-first so each source and each
+	 * target appears in at most one pair.
+	 * @param SourcePoints Open connection points of every module in the moving selection
+	 * @param World World context
+	 * @param MaxSnapDistance Maximum distance for snapping (in cm)
+	 * @return Non-conflicting snap pairs, sorted by distance (closest first)
+	 */
+	static TArray<FSnapPair> FindBestSnapPairs(
+		const TArray<UConnectionPointComponent*>& SourcePoints,
+		UWorld* World,
+		float MaxSnapDistance = 100.0f);
+	
 	/**
 	 * Calculate the transform needed to snap one module to another via connection points
 	 * @param SourcePoint Connection point on the module being moved
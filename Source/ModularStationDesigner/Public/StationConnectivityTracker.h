@@ -0,0 +1,81 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "StationDesignerTypes.h"
+
+/**
+ * Incremental connectivity for a station design using union-find
+ * 
+ * Adding modules and connections is applied incrementally in near-constant time.
+ * Removals cannot be undone in a union-find, so they mark the tracker dirty and the
+ * next query rebuilds it from the design (rebuild-on-delete). Connections are treated
+ * as undirected; FConnectModulesCommand always writes them in both directions.
+ */
+class MODULARSTATIONDESIGNER_API FStationConnectivityTracker
+{
+public:
+	FStationConnectivityTracker();
+
+	/** Rebuild from scratch from a design */
+	void Rebuild(const FStationDesign& Design);
+
+	/** Force a rebuild on the next query */
+	void Invalidate() { bDirty = true; }
+
+	/** Bring the tracker in sync with the design, rebuilding only if needed */
+	void Refresh(const FStationDesign& Design);
+
+	/** A module was appended to the design (its own connections are unioned in) */
+	void OnModuleAdded(const FModulePlacement& Module);
+
+	/** A module was removed from the design */
+	void OnModuleRemoved(const FString& ModuleID);
+
+	/** Two modules were connected */
+	void OnModulesConnected(const FString& ModuleAID, const FString& ModuleBID);
+
+	/** Two modules were disconnected */
+	void OnModulesDisconnected(const FString& ModuleAID, const FString& ModuleBID);
+
+	/** Number of connected components (1 means the station is fully connected) */
+	int32 GetNumComponents() const { return NumComponents; }
+
+	/** Check whether two modules are in the same component */
+	bool AreConnected(const FString& ModuleAID, const FString& ModuleBID);
+
+	/** Number of modules in the component containing a module (0 if unknown) */
+	int32 GetComponentSize(const FString& ModuleID);
+
+	/** Check whether the tracker needs a rebuild before it can answer queries */
+	bool IsDirty() const { return bDirty; }
+
+private:
+	/** Get or create the handle for a module ID */
+	int32 AddHandle(const FString& ModuleID);
+
+	/** Find the representative handle with path halving */
+	int32 FindRoot(int32 Handle);
+
+	/** Merge two components by size */
+	void Union(int32 HandleA, int32 HandleB);
+
+	/** ModuleID -> tracker handle */
+	TMap<FString, int32> HandleByID;
+
+	/** Union-find parent per handle */
+	TArray<int32> Parent;
+
+	/** Component size, valid for root handles */
+	TArray<int32> ComponentSize;
+
+	/** Number of live components */
+	int32 NumComponents;
+
+	/** Number of modules the tracker believes the design has */
+	int32 NumTrackedModules;
+
+	/** Set when a removal invalidated the structure */
+	bool bDirty;
+};
@@ -11,6 +11,8 @@
 
 #include "StationDesignerTypes.generated.h"
 
+class FStationModuleGraph;
+
 /**
  * Connection type enumeration for module connection points
  */
@@ -75,9 +77,20 @@ struct FModulePlacement
 
 /**
  * Data structure representing a complete station design
+ * 
+ * Modules are indexed by ModuleID through a transient hash map so lookups are O(1).
+ * Use AddModule / InsertModule / RemoveModule / RemoveModuleAt / EmptyModules to keep the index
+ * coherent; after editing Modules directly (or loading into an existing design)
+ * call RebuildModuleIndex. Lookups are not thread-safe: give worker threads their
+ * own copy of the design.
+ * 
+ * Every edit made through these helpers moves the design to a new revision. Revisions
+ * come from a process-wide counter, so two designs only share a revision when one is a
+ * copy of the other; caches can key derived data on GetRevision(). Call MarkModified
+ * after editing module fields in place.
  */
 USTRUCT(BlueprintType)
-struct FStationDesign
+struct MODULARSTATIONDESIGNER_API FStationDesign
 {
 	GENERATED_BODY()
 
@@ -93,6 +106,85 @@ struct FStationDesign
 	FStationDesign()
 		: StationName(TEXT("New Station"))
 		, DesignVersion(TEXT("1.0"))
+		, IndexedModuleCount(INDEX_NONE)
+		, IndexedRevision(0)
+		, Revision(AllocateRevision())
+		, ModuleGraphRevision(0)
 	{
 	}
+
+	/** Revision of the design contents, changes on every tracked edit */
+	uint64 GetRevision() const { return Revision; }
+
+	/** Move the design to a new revision after an in-place edit */
+	void MarkModified() const { Revision = AllocateRevision(); }
+
+	/** Find the index of a module by ID, or INDEX_NONE */
+	int32 FindModuleIndex(const FString& InModuleID) const;
+
+	/** Find a module by ID, or nullptr */
+	FModulePlacement* FindModule(const FString& InModuleID);
+	const FModulePlacement* FindModule(const FString& InModuleID) const;
+
+	/** Append a module and index it, returns its index */
+	int32 AddModule(const FModulePlacement& Module);
+
+	/** Insert a module at an index (clamped to the module count), shifting later modules up; returns its index */
+	int32 InsertModule(int32 Index, const FModulePlacement& Module);
+
+	/**
+	 * Remove a module by ID
+	 * Later modules shift down one slot, so module order is preserved
+	 * @param InModuleID Module to remove
+	 * @param OutRemovedModule Optional copy of the removed module
+	 * @return True if a module was removed
+	 */
+	bool RemoveModule(const FString& InModuleID, FModulePlacement* OutRemovedModule = nullptr);
+
+	/** Remove the module at an index, preserving the order of the rest */
+	void RemoveModuleAt(int32 Index);
+
+	/** Remove all modules */
+	void EmptyModules();
+
+	/** Rebuild the ModuleID lookup from Modules (also marks the design modified) */
+	void RebuildModuleIndex() const;
+
+	/**
+	 * Integer-handle connectivity graph for the current revision
+	 * Built on first use after each edit and shared with copies of the design, so traversals
+	 * don't re-resolve every connection ID per call. Not thread-safe, like the module lookup.
+	 */
+	const FStationModuleGraph& GetModuleGraph() const;
+
+private:
+	/** Rebuild the lookup if Modules was resized without going through the helpers */
+	void EnsureModuleIndex() const;
+
+	/** Rebuild the lookup without touching the revision, for lazy resyncs during lookups */
+	void SyncModuleIndex() const;
+
+	/** MarkModified after an edit the helpers already applied to the lookup */
+	void MarkModifiedKeepingIndex() const;
+
+	/** Transient ModuleID -> index lookup (not serialized) */
+	mutable TMap<FString, int32> ModuleIndexMap;
+
+	/** Modules.Num() when the lookup was last synchronized */
+	mutable int32 IndexedModuleCount;
+
+	/** Revision the lookup is known to match; a miss at any other revision resyncs before failing */
+	mutable uint64 IndexedRevision;
+
+	/** Get a new, never used revision number */
+	static uint64 AllocateRevision();
+
+	/** Current contents revision (transient) */
+	mutable uint64 Revision;
+
+	/** Cached connectivity graph, immutable once built so copies can share it */
+	mutable TSharedPtr<const FStationModuleGraph, ESPMode::ThreadSafe> ModuleGraph;
+
+	/** Revision ModuleGraph was built for */
+	mutable uint64 ModuleGraphRevision;
 };
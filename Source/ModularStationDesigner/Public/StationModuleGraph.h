@@ -0,0 +1,81 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "StationDesignerTypes.h"
+
+/**
+ * Compact runtime connectivity graph for a station design
+ * 
+ * Modules are addressed by dense int32 handles (their index in FStationDesign::Modules)
+ * and connections are stored in CSR layout: the neighbors of handle H are
+ * Neighbors[Offsets[H] .. Offsets[H + 1]). String IDs are resolved once in Build, so
+ * traversals only touch integers. FModulePlacement::ConnectedModuleIDs stays the
+ * serialized source of truth; FStationDesign::GetModuleGraph caches a graph per design
+ * revision, so callers should use that instead of building their own.
+ */
+class MODULARSTATIONDESIGNER_API FStationModuleGraph
+{
+public:
+	FStationModuleGraph() {}
+
+	/** Build the graph from a design, dropping connections to unknown module IDs */
+	explicit FStationModuleGraph(const FStationDesign& Design);
+
+	/** Rebuild the graph from a design */
+	void Build(const FStationDesign& Design);
+
+	/** Remove all modules and connections */
+	void Reset();
+
+	/** Number of modules (handles are 0..NumModules-1) */
+	int32 NumModules() const { return FMath::Max(Offsets.Num() - 1, 0); }
+
+	/** Number of directed connections */
+	int32 NumConnections() const { return Neighbors.Num(); }
+
+	/** Check whether a handle is in range */
+	bool IsValidHandle(int32 Handle) const { return Handle >= 0 && Handle < NumModules(); }
+
+	/** Get the connected handles of a module */
+	TConstArrayView<int32> GetNeighbors(int32 Handle) const
+	{
+		check(IsValidHandle(Handle));
+		return TConstArrayView<int32>(Neighbors.GetData() + Offsets[Handle], Offsets[Handle + 1] - Offsets[Handle]);
+	}
+
+	/** Get the number of connections leaving a module */
+	int32 GetNumNeighbors(int32 Handle) const
+	{
+		check(IsValidHandle(Handle));
+		return Offsets[Handle + 1] - Offsets[Handle];
+	}
+
+	/**
+	 * Breadth-first search following connections from a root module
+	 * @param RootHandle Module to start from
+	 * @param OutReachable Set to true for every module reachable from the root (sized to NumModules)
+	 * @return Number of reachable modules, including the root
+	 */
+	int32 FindReachable(int32 RootHandle, TBitArray<>& OutReachable) const;
+
+	/**
+	 * Find the modules linked to a root module, following connections in either direction
+	 * Matches FStationConnectivityTracker, which treats connections as undirected
+	 * @param RootHandle Module to start from
+	 * @param OutConnected Set to true for every module in the root's component (sized to NumModules)
+	 * @return Number of modules in the component, including the root
+	 */
+	int32 FindConnected(int32 RootHandle, TBitArray<>& OutConnected) const;
+
+	/** Approximate memory used by the graph arrays, in bytes */
+	SIZE_T GetAllocatedSize() const { return Offsets.GetAllocatedSize() + Neighbors.GetAllocatedSize(); }
+
+private:
+	/** Row start per module plus a trailing end offset */
+	TArray<int32> Offsets;
+
+	/** Concatenated neighbor handles */
+	TArray<int32> Neighbors;
+};
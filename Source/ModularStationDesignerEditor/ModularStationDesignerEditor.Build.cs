@@ -33,6 +33,7 @@ public class ModularStationDesignerEditor : ModuleRules
 			"WorkspaceMenuStructure",
 			"Json",
 			"JsonUtilities",
+			"DirectoryWatcher",
 			"Kismet",
 			"KismetCompiler",
 			"BlueprintGraph"
@@ -2,6 +2,10 @@
 
 #include "ModularStationDesignerEditor.h"
 #include "StationDesignerWindow.h"
+#include "ModulePreviewMeshCache.h"
+#include "ModuleDiscoveryService.h"
+#include "ModuleThumbnailCache.h"
+#include "StationLibraryIndex.h"
 #include "Modules/ModuleManager.h"
 #include "LevelEditor.h"
 #include "ToolMenus.h"
@@ -44,6 +48,12 @@ void FModularStationDesignerEditorModule::ShutdownModule()
 
 	// Unregister tab spawner
 	FGlobalTabmanager::Get()->UnregisterNomadTabSpawner(StationDesignerTabName);
+
+	// Release shared caches and their editor delegates
+	FStationLibraryIndex::Shutdown();
+	FModuleThumbnailCache::Shutdown();
+	FModulePreviewMeshCache::Shutdown();
+	FModuleDiscoveryService::Shutdown();
 }
 
 void FModularStationDesignerEditorModule::RegisterMenus()
@@ -0,0 +1,132 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ModuleCatalog.h"
+#include "ModuleDiscoveryService.h"
+
+void FModuleCatalog::Reset()
+{
+	Buckets.Reset();
+}
+
+void FModuleCatalog::ApplyDelta(const FModuleCatalogDelta& Delta)
+{
+	// Batch the whole delta: filter and append per bucket, then sort and rebuild ranges once
+	// per touched bucket, so the initial scan is O(N log N) rather than one insert per module
+	TSet<EStationModuleGroup> TouchedGroups;
+
+	if (Delta.Removed.Num() > 0)
+	{
+		TSet<const FModuleInfo*> RemovedModules;
+		RemovedModules.Reserve(Delta.Removed.Num());
+		for (const TSharedPtr<FModuleInfo>& Module : Delta.Removed)
+		{
+			if (Module.IsValid())
+			{
+				RemovedModules.Add(Module.Get());
+				TouchedGroups.Add(EStationModuleGroup::All);
+				TouchedGroups.Add(Module->ModuleGroup);
+			}
+		}
+
+		for (const EStationModuleGroup Group : TouchedGroups)
+		{
+			if (FGroupBucket* Bucket = Buckets.Find(Group))
+			{
+				Bucket->Modules.RemoveAll([&RemovedModules](const TSharedPtr<FModuleInfo>& Module)
+				{
+					return RemovedModules.Contains(Module.Get());
+				});
+			}
+		}
+	}
+
+	for (const TSharedPtr<FModuleInfo>& Module : Delta.Added)
+	{
+		if (!Module.IsValid())
+		{
+			continue;
+		}
+
+		Buckets.FindOrAdd(EStationModuleGroup::All).Modules.Add(Module);
+		TouchedGroups.Add(EStationModuleGroup::All);
+		if (Module->ModuleGroup != EStationModuleGroup::All)
+		{
+			Buckets.FindOrAdd(Module->ModuleGroup).Modules.Add(Module);
+			TouchedGroups.Add(Module->ModuleGroup);
+		}
+	}
+
+	for (const EStationModuleGroup Group : TouchedGroups)
+	{
+		FGroupBucket* Bucket = Buckets.Find(Group);
+		if (!Bucket)
+		{
+			continue;
+		}
+
+		if (Bucket->Modules.Num() == 0 && Group != EStationModuleGroup::All)
+		{
+			Buckets.Remove(Group);
+			continue;
+		}
+
+		Bucket->Modules.StableSort([](const TSharedPtr<FModuleInfo>& A, const TSharedPtr<FModuleInfo>& B) { return SortsBefore(*A, *B); });
+		RebuildTypeRanges(*Bucket);
+	}
+}
+
+TConstArrayView<TSharedPtr<FModuleInfo>> FModuleCatalog::GetModules(EStationModuleGroup Group) const
+{
+	const FGroupBucket* Bucket = Buckets.Find(Group);
+	return Bucket ? TConstArrayView<TSharedPtr<FModuleInfo>>(Bucket->Modules) : TConstArrayView<TSharedPtr<FModuleInfo>>();
+}
+
+TConstArrayView<TSharedPtr<FModuleInfo>> FModuleCatalog::GetModules(EStationModuleGroup Group, const FString& ModuleType) const
+{
+	const FGroupBucket* Bucket = Buckets.Find(Group);
+	const TPair<int32, int32>* Range = Bucket ? Bucket->TypeRanges.Find(ModuleType) : nullptr;
+	if (!Range)
+	{
+		return TConstArrayView<TSharedPtr<FModuleInfo>>();
+	}
+
+	return TConstArrayView<TSharedPtr<FModuleInfo>>(Bucket->Modules.GetData() + Range->Key, Range->Value);
+}
+
+void FModuleCatalog::GetModuleTypes(EStationModuleGroup Group, TArray<FString>& OutTypes) const
+{
+	OutTypes.Reset();
+	if (const FGroupBucket* Bucket = Buckets.Find(Group))
+	{
+		Bucket->TypeRanges.GenerateKeyArray(OutTypes);
+		OutTypes.Sort();
+	}
+}
+
+void FModuleCatalog::RebuildTypeRanges(FGroupBucket& Bucket)
+{
+	Bucket.TypeRanges.Reset();
+
+	int32 RangeStart = 0;
+	for (int32 Index = 1; Index <= Bucket.Modules.Num(); ++Index)
+	{
+		if (Index == Bucket.Modules.Num() || Bucket.Modules[Index]->ModuleType != Bucket.Modules[RangeStart]->ModuleType)
+		{
+			Bucket.TypeRanges.Add(Bucket.Modules[RangeStart]->ModuleType, TPair<int32, int32>(RangeStart, Index - RangeStart));
+			RangeStart = Index;
+		}
+	}
+}
+
+bool FModuleCatalog::SortsBefore(const FModuleInfo& A, const FModuleInfo& B)
+{
+	if (A.ModuleType != B.ModuleType)
+	{
+		return A.ModuleType < B.ModuleType;
+	}
+	if (A.Name != B.Name)
+	{
+		return A.Name < B.Name;
+	}
+	return A.BlueprintPath < B.BlueprintPath;
+}
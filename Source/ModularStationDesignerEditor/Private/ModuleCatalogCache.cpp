@@ -0,0 +1,257 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ModuleCatalogCache.h"
+#include "AssetRegistry/AssetData.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Engine/Blueprint.h"
+#include "Misc/PackageName.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace
+{
+	/** Bump when the catalog layout or discovery rules change to discard old catalogs */
+	constexpr int32 ModuleCatalogVersion = 2;
+
+	/** Discovery rules differ between integrated and name-based builds, so catalogs are not shared */
+#if ADASTREA_INTEGRATION_ENABLED
+	constexpr bool bCatalogIntegrationEnabled = true;
+#else
+	constexpr bool bCatalogIntegrationEnabled = false;
+#endif
+
+	/** Deepest Blueprint-on-Blueprint chain folded into a discovery stamp */
+	constexpr int32 MaxStampedAncestors = 16;
+}
+
+FModuleCatalogCache& FModuleCatalogCache::Get()
+{
+	static FModuleCatalogCache Instance;
+	return Instance;
+}
+
+FModuleCatalogCache::FModuleCatalogCache()
+	: bDirty(false)
+{
+	Load();
+}
+
+bool FModuleCatalogCache::Find(const FString& ObjectPath, const FString& PackageStamp, bool& bOutIsModule, FModuleInfo& OutInfo) const
+{
+	const FEntry* Entry = Entries.Find(ObjectPath);
+	if (!Entry || PackageStamp.IsEmpty() || Entry->PackageStamp != PackageStamp)
+	{
+		return false;
+	}
+
+	bOutIsModule = Entry->bIsModule;
+	if (bOutIsModule)
+	{
+		OutInfo = Entry->Info;
+	}
+	return true;
+}
+
+void FModuleCatalogCache::Store(const FString& ObjectPath, const FString& PackageStamp, bool bIsModule, const FModuleInfo& Info)
+{
+	if (PackageStamp.IsEmpty())
+	{
+		return; // Can't tell later whether it changed, so don't cache it
+	}
+
+	FEntry& Entry = Entries.FindOrAdd(ObjectPath);
+	Entry.PackageStamp = PackageStamp;
+	Entry.bIsModule = bIsModule;
+	Entry.Info = bIsModule ? Info : FModuleInfo();
+	bDirty = true;
+}
+
+void FModuleCatalogCache::Remove(const FString& ObjectPath)
+{
+	if (Entries.Remove(ObjectPath) > 0)
+	{
+		bDirty = true;
+	}
+}
+
+void FModuleCatalogCache::RetainOnly(const TSet<FString>& ObjectPaths)
+{
+	for (auto It = Entries.CreateIterator(); It; ++It)
+	{
+		if (!ObjectPaths.Contains(It.Key()))
+		{
+			It.RemoveCurrent();
+			bDirty = true;
+		}
+	}
+}
+
+FString FModuleCatalogCache::GetPackageStamp(const IAssetRegistry& AssetRegistry, const FAssetData& AssetData)
+{
+	TOptional<FAssetPackageData> PackageData = AssetRegistry.GetAssetPackageDataCopy(AssetData.PackageName);
+	if (!PackageData.IsSet())
+	{
+		return FString();
+	}
+
+	return FString::Printf(TEXT("%s:%lld"), *LexToString(PackageData->GetPackageSavedHash()), PackageData->DiskSize);
+}
+
+FString FModuleCatalogCache::GetDiscoveryStamp(const IAssetRegistry& AssetRegistry, const FAssetData& AssetData)
+{
+	FString Stamp = GetPackageStamp(AssetRegistry, AssetData);
+	if (Stamp.IsEmpty())
+	{
+		return Stamp;
+	}
+
+	// Reparenting an ancestor Blueprint changes whether this one is a module without touching its package
+	FString ParentClassPath = AssetData.GetTagValueRef<FString>(FBlueprintTags::ParentClassPath);
+	for (int32 Depth = 0; Depth < MaxStampedAncestors && !ParentClassPath.IsEmpty(); ++Depth)
+	{
+		Stamp += TEXT("|") + ParentClassPath;
+
+		const FString ParentObjectPath = FPackageName::ExportTextPathToObjectPath(ParentClassPath);
+		const FName ParentPackageName(FPackageName::ObjectPathToPackageName(ParentObjectPath));
+		if (FPackageName::IsScriptPackage(ParentPackageName.ToString()))
+		{
+			break; // Native parent, fixed by the build
+		}
+
+		TArray<FAssetData> ParentAssets;
+		AssetRegistry.GetAssetsByPackageName(ParentPackageName, ParentAssets);
+		const FAssetData* ParentBlueprint = ParentAssets.FindByPredicate([](const FAssetData& Candidate)
+		{
+			return Candidate.IsInstanceOf(UBlueprint::StaticClass());
+		});
+		if (!ParentBlueprint)
+		{
+			break;
+		}
+
+		Stamp += TEXT("|") + GetPackageStamp(AssetRegistry, *ParentBlueprint);
+		ParentClassPath = ParentBlueprint->GetTagValueRef<FString>(FBlueprintTags::ParentClassPath);
+	}
+
+	return Stamp;
+}
+
+FString FModuleCatalogCache::GetCacheFilePath()
+{
+	return FPaths::ProjectSavedDir() / TEXT("StationDesigner") / TEXT("ModuleCatalog.json");
+}
+
+void FModuleCatalogCache::Load()
+{
+	Entries.Reset();
+
+	FString JsonString;
+	if (!FFileHelper::LoadFileToString(JsonString, *GetCacheFilePath()))
+	{
+		return; // First run
+	}
+
+	TSharedPtr<FJsonObject> Root;
+	const TSharedRef<TJsonReader<TCHAR>> Reader = TJsonReaderFactory<TCHAR>::Create(JsonString);
+	if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Ignoring unreadable module catalog: %s"), *GetCacheFilePath());
+		return;
+	}
+
+	bool bIntegrationEnabled = false;
+	if (Root->GetIntegerField(TEXT("version")) != ModuleCatalogVersion ||
+		!Root->TryGetBoolField(TEXT("integration"), bIntegrationEnabled) ||
+		bIntegrationEnabled != bCatalogIntegrationEnabled)
+	{
+		return;
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* AssetValues = nullptr;
+	if (!Root->TryGetArrayField(TEXT("assets"), AssetValues))
+	{
+		return;
+	}
+
+	Entries.Reserve(AssetValues->Num());
+	for (const TSharedPtr<FJsonValue>& Value : *AssetValues)
+	{
+		const TSharedPtr<FJsonObject>* AssetObject = nullptr;
+		if (!Value.IsValid() || !Value->TryGetObject(AssetObject))
+		{
+			continue;
+		}
+
+		FString ObjectPath;
+		FEntry Entry;
+		if (!(*AssetObject)->TryGetStringField(TEXT("path"), ObjectPath) ||
+			!(*AssetObject)->TryGetStringField(TEXT("stamp"), Entry.PackageStamp))
+		{
+			continue;
+		}
+
+		Entry.bIsModule = (*AssetObject)->GetBoolField(TEXT("isModule"));
+		if (Entry.bIsModule)
+		{
+			Entry.Info.Name = (*AssetObject)->GetStringField(TEXT("name"));
+			Entry.Info.BlueprintPath = ObjectPath;
+			Entry.Info.ModuleType = (*AssetObject)->GetStringField(TEXT("type"));
+			Entry.Info.ModuleGroup = static_cast<EStationModuleGroup>((*AssetObject)->GetIntegerField(TEXT("group")));
+			Entry.Info.PowerConsumption = (*AssetObject)->GetNumberField(TEXT("power"));
+		}
+
+		Entries.Add(ObjectPath, MoveTemp(Entry));
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("Loaded module catalog with %d assets"), Entries.Num());
+}
+
+bool FModuleCatalogCache::SaveIfDirty()
+{
+	if (!bDirty)
+	{
+		return true;
+	}
+
+	FString JsonString;
+	const TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+		TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&JsonString);
+
+	Writer->WriteObjectStart();
+	Writer->WriteValue(TEXT("version"), ModuleCatalogVersion);
+	Writer->WriteValue(TEXT("integration"), bCatalogIntegrationEnabled);
+	Writer->WriteArrayStart(TEXT("assets"));
+	for (const auto& Pair : Entries)
+	{
+		const FEntry& Entry = Pair.Value;
+
+		Writer->WriteObjectStart();
+		Writer->WriteValue(TEXT("path"), Pair.Key);
+		Writer->WriteValue(TEXT("stamp"), Entry.PackageStamp);
+		Writer->WriteValue(TEXT("isModule"), Entry.bIsModule);
+		if (Entry.bIsModule)
+		{
+			Writer->WriteValue(TEXT("name"), Entry.Info.Name);
+			Writer->WriteValue(TEXT("type"), Entry.Info.ModuleType);
+			Writer->WriteValue(TEXT("group"), static_cast<int32>(Entry.Info.ModuleGroup));
+			Writer->WriteValue(TEXT("power"), Entry.Info.PowerConsumption);
+		}
+		Writer->WriteObjectEnd();
+	}
+	Writer->WriteArrayEnd();
+	Writer->WriteObjectEnd();
+	Writer->Close();
+
+	if (!FFileHelper::SaveStringToFile(JsonString, *GetCacheFilePath()))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Failed to write module catalog: %s"), *GetCacheFilePath());
+		return false;
+	}
+
+	bDirty = false;
+	return true;
+}
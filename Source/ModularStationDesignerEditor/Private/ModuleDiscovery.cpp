@@ -1,14 +1,20 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "ModuleDiscovery.h"
+#include "ModuleCatalogCache.h"
+#include "ModuleDiscoveryService.h"
 #include "Engine/Blueprint.h"
 #include "AssetRegistry/AssetRegistryModule.h"
-#include "UObject/UObjectIterator.h"
+#include "Misc/PackageName.h"
 
 #if ADASTREA_INTEGRATION_ENABLED
 #include "Stations/SpaceStationModule.h"
 #endif
 
+const FName FModuleDiscovery::ModuleTypeTag(TEXT("ModuleType"));
+const FName FModuleDiscovery::ModulePowerTag(TEXT("ModulePower"));
+const FName FModuleDiscovery::ModuleGroupTag(TEXT("ModuleGroup"));
+
 TArray<FModuleInfo> FModuleDiscovery::DiscoverModules()
 {
 	TArray<FModuleInfo> Modules;
@@ -18,134 +24,266 @@ TArray<FModuleInfo> FModuleDiscovery::DiscoverModules()
 		FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
 	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
 
-	// Find all Blueprint assets
+	// Find all Blueprint assets (metadata only, nothing is loaded)
 	TArray<FAssetData> BlueprintAssets;
 	AssetRegistry.GetAssetsByClass(UBlueprint::StaticClass()->GetClassPathName(), BlueprintAssets);
 
-	// Filter for station module Blueprints
-	// Note: This loads each Blueprint into memory to check inheritance.
-	// For large projects with many Blueprints, consider using AssetRegistry tags
-	// or implementing pagination/caching to improve performance.
+	// Only packages changed since the last scan are re-evaluated; the rest come from the catalog
+	FModuleCatalogCache& Catalog = FModuleCatalogCache::Get();
+	TSet<FString> SeenPaths;
+	SeenPaths.Reserve(BlueprintAssets.Num());
+	int32 NumEvaluated = 0;
+
+#if ADASTREA_INTEGRATION_ENABLED
+	// Every class deriving from ASpaceStationModule, including Blueprint-on-Blueprint chains.
+	// Only needed for cache misses, so gathered on the first one
+	TSet<FTopLevelAssetPath> ModuleClassPaths;
+	bool bHaveModuleClassPaths = false;
+#endif
+
 	for (const FAssetData& AssetData : BlueprintAssets)
 	{
-		UBlueprint* Blueprint = Cast<UBlueprint>(AssetData.GetAsset());
-		if (!Blueprint || !Blueprint->GeneratedClass)
+		const FString ObjectPath = AssetData.GetObjectPathString();
+		const FString PackageStamp = FModuleCatalogCache::GetDiscoveryStamp(AssetRegistry, AssetData);
+		SeenPaths.Add(ObjectPath);
+
+		bool bIsModule = false;
+		FModuleInfo Info;
+		if (Catalog.Find(ObjectPath, PackageStamp, bIsModule, Info))
 		{
+			if (bIsModule)
+			{
+				Modules.Add(MoveTemp(Info));
+			}
 			continue;
 		}
 
+		++NumEvaluated;
+
 #if ADASTREA_INTEGRATION_ENABLED
-		// Check if Blueprint inherits from ASpaceStationModule
-		if (Blueprint->GeneratedClass->IsChildOf(ASpaceStationModule::StaticClass()))
+		if (!bHaveModuleClassPaths)
 		{
-			FModuleInfo Info = ExtractModuleInfo(Blueprint);
-			Info.BlueprintPath = AssetData.GetObjectPathString();
-			Modules.Add(Info);
+			AssetRegistry.GetDerivedClassNames({ ASpaceStationModule::StaticClass()->GetClassPathName() }, {}, ModuleClassPaths);
+			bHaveModuleClassPaths = true;
 		}
+
+		// Check the generated class against the derived set instead of loading the Blueprint
+		const FString GeneratedClassPath = AssetData.GetTagValueRef<FString>(FBlueprintTags::GeneratedClassPath);
+		bIsModule = !GeneratedClassPath.IsEmpty()
+			? ModuleClassPaths.Contains(FTopLevelAssetPath(FPackageName::ExportTextPathToObjectPath(GeneratedClassPath)))
+			: IsStationModuleAsset(AssetData);
 #else
-		// Fallback: Check if this looks like a station module (name-based)
-		FString AssetName = AssetData.AssetName.ToString();
-		if (AssetName.Contains(TEXT("Module")) || 
-			AssetName.Contains(TEXT("Station")) ||
-			AssetName.Contains(TEXT("Docking")) ||
-			AssetName.Contains(TEXT("Reactor")) ||
-			AssetName.Contains(TEXT("Cargo")))
+		bIsModule = IsStationModuleAsset(AssetData);
+#endif
+
+		if (bIsModule)
 		{
-			FModuleInfo Info = ExtractModuleInfo(Blueprint);
-			Info.BlueprintPath = AssetData.GetObjectPathString();
-			Modules.Add(Info);
+			Info = BuildModuleInfo(AssetData);
+		}
+		Catalog.Store(ObjectPath, PackageStamp, bIsModule, Info);
+
+		if (bIsModule)
+		{
+			Modules.Add(MoveTemp(Info));
 		}
-#endif
 	}
 
+	// Drop assets that were deleted or moved, then persist for the next session
+	Catalog.RetainOnly(SeenPaths);
+	Catalog.SaveIfDirty();
+
+	UE_LOG(LogTemp, Verbose, TEXT("Module catalog: %d of %d Blueprints re-evaluated"), NumEvaluated, BlueprintAssets.Num());
 	UE_LOG(LogTemp, Log, TEXT("Discovered %d station modules"), Modules.Num());
 	return Modules;
 }
 
-TArray<FModuleInfo> FModuleDiscovery::DiscoverModulesFiltered(EStationModuleGroup GroupFilter)
+bool FModuleDiscovery::TryExtractModuleInfo(const FAssetData& AssetData, FModuleInfo& OutInfo)
+{
+	if (!IsStationModuleAsset(AssetData))
+	{
+		return false;
+	}
+
+	OutInfo = BuildModuleInfo(AssetData);
+	return true;
+}
+
+FModuleInfo FModuleDiscovery::BuildModuleInfo(const FAssetData& AssetData)
 {
-	TArray<FModuleInfo> AllModules = DiscoverModules();
-	
-	if (GroupFilter == EStationModuleGroup::All)
+	FModuleInfo Info;
+	Info.Name = AssetData.AssetName.ToString();
+	Info.BlueprintPath = AssetData.GetObjectPathString();
+
+	// Module properties from tags; these only exist when Adastrea marks them AssetRegistrySearchable
+	FString TagValue;
+	const bool bHasType = AssetData.GetTagValue(ModuleTypeTag, TagValue) && !TagValue.IsEmpty();
+	if (bHasType)
 	{
-		return AllModules;
+		Info.ModuleType = TagValue;
 	}
 
-	TArray<FModuleInfo> FilteredModules;
-	for (const FModuleInfo& Module : AllModules)
+	const bool bHasGroup = AssetData.GetTagValue(ModuleGroupTag, TagValue) && ParseModuleGroup(TagValue, Info.ModuleGroup);
+
+	const bool bHasPower = AssetData.GetTagValue(ModulePowerTag, TagValue) && FCString::IsNumeric(*TagValue);
+	if (bHasPower)
 	{
-		if (Module.ModuleGroup == GroupFilter)
-		{
-			FilteredModules.Add(Module);
-		}
+		Info.PowerConsumption = FCString::Atof(*TagValue);
+	}
+
+	if (bHasType && bHasGroup && bHasPower)
+	{
+		UE_LOG(LogTemp, Verbose, TEXT("Read module info from tags: %s (Power: %.1f, Group: %d)"),
+			*Info.ModuleType, Info.PowerConsumption, (int32)Info.ModuleGroup);
+		return Info;
+	}
+
+	// Tags missing (older Adastrea or properties not searchable): the CDO is authoritative.
+	// Results are kept in the module catalog, so each package is loaded once per change
+	if (ReadModuleInfoFromClassDefault(AssetData, Info))
+	{
+		return Info;
 	}
 
-	return FilteredModules;
+	// Standalone: name-based inference
+	if (!bHasType)
+	{
+		Info.ModuleType = Info.Name;
+	}
+	if (!bHasGroup)
+	{
+		Info.ModuleGroup = DetermineModuleGroup(Info.Name);
+	}
+	if (!bHasPower)
+	{
+		Info.PowerConsumption = DeterminePowerConsumption(Info.Name);
+	}
+	return Info;
 }
 
-FModuleInfo FModuleDiscovery::ExtractModuleInfo(UBlueprint* Blueprint)
+bool FModuleDiscovery::ReadModuleInfoFromClassDefault(const FAssetData& AssetData, FModuleInfo& InOutInfo)
 {
-	FModuleInfo Info;
+#if ADASTREA_INTEGRATION_ENABLED
+	const FString GeneratedClassPath = AssetData.GetTagValueRef<FString>(FBlueprintTags::GeneratedClassPath);
+	UClass* GeneratedClass = !GeneratedClassPath.IsEmpty()
+		? FSoftClassPath(FPackageName::ExportTextPathToObjectPath(GeneratedClassPath)).TryLoadClass<ASpaceStationModule>()
+		: nullptr;
+	if (!GeneratedClass)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Module tags missing and class could not be loaded: %s"), *AssetData.GetObjectPathString());
+		return false;
+	}
 
-	if (!Blueprint)
+	const ASpaceStationModule* ModuleCDO = GetDefault<ASpaceStationModule>(GeneratedClass);
+	if (!ModuleCDO)
 	{
-		return Info;
+		return false;
 	}
 
-	Info.Name = Blueprint->GetName();
-	Info.ModuleType = Info.Name;
+	const FString ModuleTypeName = ModuleCDO->GetModuleType();
+	InOutInfo.ModuleType = ModuleTypeName.IsEmpty() ? InOutInfo.Name : ModuleTypeName;
+	InOutInfo.PowerConsumption = ModuleCDO->GetModulePower();
+	InOutInfo.ModuleGroup = ModuleCDO->GetModuleGroup();
+
+	UE_LOG(LogTemp, Verbose, TEXT("Read module info from CDO: %s (Power: %.1f, Group: %d)"),
+		*InOutInfo.ModuleType, InOutInfo.PowerConsumption, (int32)InOutInfo.ModuleGroup);
+	return true;
+#else
+	return false;
+#endif
+}
 
+bool FModuleDiscovery::IsStationModuleAsset(const FAssetData& AssetData)
+{
 #if ADASTREA_INTEGRATION_ENABLED
-	// Read actual module properties from Blueprint's Class Default Object (CDO)
-	if (Blueprint->GeneratedClass && Blueprint->GeneratedClass->IsChildOf(ASpaceStationModule::StaticClass()))
+	// Direct native parent check from tags; DiscoverModules also handles deeper Blueprint chains
+	const FString NativeParentClass = AssetData.GetTagValueRef<FString>(FBlueprintTags::NativeParentClassPath);
+	if (!NativeParentClass.IsEmpty())
 	{
-		ASpaceStationModule* ModuleCDO = Cast<ASpaceStationModule>(Blueprint->GeneratedClass->GetDefaultObject());
-		if (ModuleCDO)
-		{
-			// Defensive validation: ensure methods return valid data
-			// Note: If Adastrea API changes, these calls may need updates
-			FString ModuleTypeName = ModuleCDO->GetModuleType();
-			if (!ModuleTypeName.IsEmpty())
-			{
-				Info.ModuleType = ModuleTypeName;
-			}
-			
-			Info.PowerConsumption = ModuleCDO->GetModulePower();
-			Info.ModuleGroup = ModuleCDO->GetModuleGroup();
-			
-			UE_LOG(LogTemp, Verbose, TEXT("Read module info from CDO: %s (Power: %.1f, Group: %d)"),
-				*Info.ModuleType, Info.PowerConsumption, (int32)Info.ModuleGroup);
-			return Info;
-		}
+		const FTopLevelAssetPath NativeParentPath(FPackageName::ExportTextPathToObjectPath(NativeParentClass));
+		const UClass* NativeParent = FindObject<UClass>(NativeParentPath);
+		return NativeParent && NativeParent->IsChildOf(ASpaceStationModule::StaticClass());
 	}
+	return false;
+#else
+	// Fallback: Check if this looks like a station module (name-based)
+	FString AssetName = AssetData.AssetName.ToString();
+	return AssetName.Contains(TEXT("Module")) || 
+		AssetName.Contains(TEXT("Station")) ||
+		AssetName.Contains(TEXT("Docking")) ||
+		AssetName.Contains(TEXT("Reactor")) ||
+		AssetName.Contains(TEXT("Cargo"));
 #endif
+}
 
-	// Fallback: Infer module properties from name
-	Info.ModuleGroup = DetermineModuleGroup(Info.Name);
-	
-	// Default power values based on module type
-	if (Info.Name.Contains(TEXT("Reactor")))
+bool FModuleDiscovery::ParseModuleGroup(const FString& Value, EStationModuleGroup& OutGroup)
+{
+	struct FGroupName
+	{
+		const TCHAR* Name;
+		EStationModuleGroup Group;
+	};
+
+	static const FGroupName GroupNames[] =
+	{
+		{ TEXT("Docking"), EStationModuleGroup::Docking },
+		{ TEXT("Power"), EStationModuleGroup::Power },
+		{ TEXT("Storage"), EStationModuleGroup::Storage },
+		{ TEXT("Processing"), EStationModuleGroup::Processing },
+		{ TEXT("Defence"), EStationModuleGroup::Defence },
+		{ TEXT("Habitation"), EStationModuleGroup::Habitation },
+		{ TEXT("Public"), EStationModuleGroup::Public },
+		{ TEXT("Connection"), EStationModuleGroup::Connection },
+		{ TEXT("Other"), EStationModuleGroup::Other }
+	};
+
+	// Accept both "Docking" and "EStationModuleGroup::Docking"
+	FString GroupName = Value;
+	int32 ScopeIndex;
+	if (GroupName.FindLastChar(TEXT(':'), ScopeIndex))
 	{
-		Info.PowerConsumption = -500.0f; // Generates power
+		GroupName.RightChopInline(ScopeIndex + 1);
 	}
-	else if (Info.Name.Contains(TEXT("Solar")))
+
+	for (const FGroupName& Entry : GroupNames)
 	{
-		Info.PowerConsumption = -200.0f; // Generates power
+		if (GroupName.Equals(Entry.Name, ESearchCase::IgnoreCase))
+		{
+			OutGroup = Entry.Group;
+			return true;
+		}
 	}
-	else if (Info.Name.Contains(TEXT("Docking")))
+
+	return false;
+}
+
+TConstArrayView<TSharedPtr<FModuleInfo>> FModuleDiscovery::DiscoverModulesFiltered(EStationModuleGroup GroupFilter, const FString& ModuleType)
+{
+	// Slices of the grouped catalog instead of a full rescan and linear filter
+	const FModuleCatalog& Catalog = FModuleDiscoveryService::Get().GetCatalog();
+	return ModuleType.IsEmpty() ? Catalog.GetModules(GroupFilter) : Catalog.GetModules(GroupFilter, ModuleType);
+}
+
+float FModuleDiscovery::DeterminePowerConsumption(const FString& ModuleName)
+{
+	// Default power values based on module type
+	if (ModuleName.Contains(TEXT("Reactor")))
+	{
+		return -500.0f; // Generates power
+	}
+	else if (ModuleName.Contains(TEXT("Solar")))
 	{
-		Info.PowerConsumption = 50.0f;
+		return -200.0f; // Generates power
 	}
-	else if (Info.Name.Contains(TEXT("Marketplace")))
+	else if (ModuleName.Contains(TEXT("Docking")))
 	{
-		Info.PowerConsumption = 40.0f;
+		return 50.0f;
 	}
-	else
+	else if (ModuleName.Contains(TEXT("Marketplace")))
 	{
-		Info.PowerConsumption = 30.0f;
+		return 40.0f;
 	}
 
-	return Info;
+	return 30.0f;
 }
 
 EStationModuleGroup FModuleDiscovery::DetermineModuleGroup(const FString& ModuleName)
@@ -0,0 +1,225 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ModuleDiscoveryService.h"
+#include "ModuleCatalogCache.h"
+#include "Engine/Blueprint.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+
+TUniquePtr<FModuleDiscoveryService> FModuleDiscoveryService::Instance;
+
+FModuleDiscoveryService& FModuleDiscoveryService::Get()
+{
+	if (!Instance.IsValid())
+	{
+		Instance = TUniquePtr<FModuleDiscoveryService>(new FModuleDiscoveryService());
+	}
+	return *Instance;
+}
+
+void FModuleDiscoveryService::Shutdown()
+{
+	Instance.Reset();
+}
+
+FModuleDiscoveryService::FModuleDiscoveryService()
+	: bCatalogReady(false)
+{
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+	AssetAddedHandle = AssetRegistry.OnAssetAdded().AddRaw(this, &FModuleDiscoveryService::HandleAssetAdded);
+	AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddRaw(this, &FModuleDiscoveryService::HandleAssetRemoved);
+	AssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddRaw(this, &FModuleDiscoveryService::HandleAssetRenamed);
+	AssetUpdatedHandle = AssetRegistry.OnAssetUpdated().AddRaw(this, &FModuleDiscoveryService::HandleAssetUpdated);
+
+	if (AssetRegistry.IsLoadingAssets())
+	{
+		// Per-asset events during the initial scan are ignored; one discovery runs at the end
+		FilesLoadedHandle = AssetRegistry.OnFilesLoaded().AddRaw(this, &FModuleDiscoveryService::HandleFilesLoaded);
+	}
+	else
+	{
+		HandleFilesLoaded();
+	}
+}
+
+FModuleDiscoveryService::~FModuleDiscoveryService()
+{
+	if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>("AssetRegistry"))
+	{
+		IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+		AssetRegistry.OnFilesLoaded().Remove(FilesLoadedHandle);
+		AssetRegistry.OnAssetAdded().Remove(AssetAddedHandle);
+		AssetRegistry.OnAssetRemoved().Remove(AssetRemovedHandle);
+		AssetRegistry.OnAssetRenamed().Remove(AssetRenamedHandle);
+		AssetRegistry.OnAssetUpdated().Remove(AssetUpdatedHandle);
+	}
+
+	// Keep single-asset patches for the next session
+	FModuleCatalogCache::Get().SaveIfDirty();
+}
+
+void FModuleDiscoveryService::GetModules(TArray<TSharedPtr<FModuleInfo>>& OutModules) const
+{
+	OutModules.Reset(ModulesByPath.Num());
+	for (const auto& Pair : ModulesByPath)
+	{
+		OutModules.Add(Pair.Value);
+	}
+}
+
+void FModuleDiscoveryService::Rescan()
+{
+	TArray<FModuleInfo> DiscoveredModules = FModuleDiscovery::DiscoverModules();
+
+	FModuleCatalogDelta Delta;
+	TMap<FString, TSharedPtr<FModuleInfo>> NewModulesByPath;
+	NewModulesByPath.Reserve(DiscoveredModules.Num());
+
+	for (FModuleInfo& Module : DiscoveredModules)
+	{
+		// Unchanged modules keep their existing entry so listeners see no churn
+		TSharedPtr<FModuleInfo> Existing;
+		if (ModulesByPath.RemoveAndCopyValue(Module.BlueprintPath, Existing) && HasSameProperties(*Existing, Module))
+		{
+			NewModulesByPath.Add(Module.BlueprintPath, Existing);
+			continue;
+		}
+
+		if (Existing.IsValid())
+		{
+			Delta.Removed.Add(Existing);
+		}
+
+		TSharedPtr<FModuleInfo> Added = MakeShared<FModuleInfo>(MoveTemp(Module));
+		NewModulesByPath.Add(Added->BlueprintPath, Added);
+		Delta.Added.Add(Added);
+	}
+
+	// Anything left over was not rediscovered
+	for (const auto& Pair : ModulesByPath)
+	{
+		Delta.Removed.Add(Pair.Value);
+	}
+
+	ModulesByPath = MoveTemp(NewModulesByPath);
+	bCatalogReady = true;
+	Broadcast(Delta);
+}
+
+void FModuleDiscoveryService::HandleFilesLoaded()
+{
+	Rescan();
+}
+
+void FModuleDiscoveryService::HandleAssetAdded(const FAssetData& AssetData)
+{
+	if (!bCatalogReady || !IsBlueprintAsset(AssetData))
+	{
+		return;
+	}
+
+	FModuleCatalogDelta Delta;
+	PatchAsset(AssetData, Delta);
+	Broadcast(Delta);
+}
+
+void FModuleDiscoveryService::HandleAssetRemoved(const FAssetData& AssetData)
+{
+	if (!bCatalogReady || !IsBlueprintAsset(AssetData))
+	{
+		return;
+	}
+
+	const FString ObjectPath = AssetData.GetObjectPathString();
+	FModuleCatalogCache::Get().Remove(ObjectPath);
+
+	FModuleCatalogDelta Delta;
+	RemoveModule(ObjectPath, Delta);
+	Broadcast(Delta);
+}
+
+void FModuleDiscoveryService::HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+	if (!bCatalogReady || !IsBlueprintAsset(AssetData))
+	{
+		return;
+	}
+
+	FModuleCatalogCache::Get().Remove(OldObjectPath);
+
+	FModuleCatalogDelta Delta;
+	RemoveModule(OldObjectPath, Delta);
+	PatchAsset(AssetData, Delta);
+	Broadcast(Delta);
+}
+
+void FModuleDiscoveryService::HandleAssetUpdated(const FAssetData& AssetData)
+{
+	// Tags change when a Blueprint is saved or recompiled
+	HandleAssetAdded(AssetData);
+}
+
+void FModuleDiscoveryService::PatchAsset(const FAssetData& AssetData, FModuleCatalogDelta& Delta)
+{
+	const FString ObjectPath = AssetData.GetObjectPathString();
+
+	FModuleInfo Info;
+	const bool bIsModule = FModuleDiscovery::TryExtractModuleInfo(AssetData, Info);
+
+	const IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	FModuleCatalogCache::Get().Store(ObjectPath, FModuleCatalogCache::GetDiscoveryStamp(AssetRegistry, AssetData), bIsModule, Info);
+
+	const TSharedPtr<FModuleInfo>* Existing = ModulesByPath.Find(ObjectPath);
+	if (!bIsModule)
+	{
+		RemoveModule(ObjectPath, Delta);
+		return;
+	}
+
+	if (Existing && HasSameProperties(**Existing, Info))
+	{
+		return;
+	}
+
+	RemoveModule(ObjectPath, Delta);
+
+	TSharedPtr<FModuleInfo> Added = MakeShared<FModuleInfo>(MoveTemp(Info));
+	ModulesByPath.Add(ObjectPath, Added);
+	Delta.Added.Add(Added);
+}
+
+void FModuleDiscoveryService::RemoveModule(const FString& ObjectPath, FModuleCatalogDelta& Delta)
+{
+	TSharedPtr<FModuleInfo> Removed;
+	if (ModulesByPath.RemoveAndCopyValue(ObjectPath, Removed))
+	{
+		Delta.Removed.Add(Removed);
+	}
+}
+
+void FModuleDiscoveryService::Broadcast(const FModuleCatalogDelta& Delta)
+{
+	if (Delta.IsEmpty())
+	{
+		return;
+	}
+
+	Catalog.ApplyDelta(Delta);
+	SearchIndex.ApplyDelta(Delta);
+
+	UE_LOG(LogTemp, Verbose, TEXT("Module catalog changed: %d added, %d removed"), Delta.Added.Num(), Delta.Removed.Num());
+	CatalogChanged.Broadcast(Delta);
+}
+
+bool FModuleDiscoveryService::IsBlueprintAsset(const FAssetData& AssetData)
+{
+	return AssetData.AssetClassPath == UBlueprint::StaticClass()->GetClassPathName();
+}
+
+bool FModuleDiscoveryService::HasSameProperties(const FModuleInfo& A, const FModuleInfo& B)
+{
+	return A.Name == B.Name &&
+		A.ModuleType == B.ModuleType &&
+		A.ModuleGroup == B.ModuleGroup &&
+		A.PowerConsumption == B.PowerConsumption;
+}
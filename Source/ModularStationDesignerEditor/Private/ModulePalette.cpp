@@ -2,6 +2,8 @@
 
 #include "ModulePalette.h"
 #include "ModuleDragDropOp.h"
+#include "ModuleDiscoveryService.h"
+#include "ModuleThumbnailCache.h"
 #include "Widgets/Input/SSearchBox.h"
 #include "Widgets/Input/SButton.h"
 #include "Widgets/Views/SListView.h"
@@ -9,6 +11,7 @@
 #include "Widgets/Layout/SBorder.h"
 #include "Widgets/Text/STextBlock.h"
 #include "Widgets/Images/SImage.h"
+#include "Widgets/SOverlay.h"
 #include "Styling/AppStyle.h"
 
 #define LOCTEXT_NAMESPACE "ModulePalette"
@@ -18,8 +21,9 @@ void SModulePalette::Construct(const FArguments& InArgs)
 	CurrentGroupFilter = EStationModuleGroup::All;
 	CurrentSearchText = FString();
 
-	// Load modules
-	RefreshModuleList();
+	// Start from the live catalog and follow its changes
+	CatalogChangedHandle = FModuleDiscoveryService::Get().OnCatalogChanged().AddSP(this, &SModulePalette::OnModuleCatalogChanged);
+	ApplyFilters();
 
 	ChildSlot
 	[
@@ -56,19 +60,23 @@ void SModulePalette::Construct(const FArguments& InArgs)
 	];
 }
 
-void SModulePalette::RefreshModuleList()
+SModulePalette::~SModulePalette()
 {
-	// Discover modules
-	TArray<FModuleInfo> DiscoveredModules = FModuleDiscovery::DiscoverModules();
-	
-	// Convert to shared pointers
-	AllModules.Empty();
-	for (const FModuleInfo& Module : DiscoveredModules)
+	if (FModuleDiscoveryService::IsAvailable())
 	{
-		AllModules.Add(MakeShared<FModuleInfo>(Module));
+		FModuleDiscoveryService::Get().OnCatalogChanged().Remove(CatalogChangedHandle);
 	}
+}
 
-	// Apply filters
+void SModulePalette::RefreshModuleList()
+{
+	FModuleDiscoveryService::Get().Rescan();
+}
+
+void SModulePalette::OnModuleCatalogChanged(const FModuleCatalogDelta& Delta)
+{
+	// The catalog has already applied the delta; re-slicing it (or re-querying the search index)
+	// keeps the list in catalog order, so edited modules stay in place instead of moving to the end
 	ApplyFilters();
 }
 
@@ -89,7 +97,7 @@ TSharedRef<ITableRow> SModulePalette::OnGenerateModuleRow(
 			[
 				SNew(SHorizontalBox)
 
-				// Thumbnail (placeholder for now)
+				// Thumbnail, requested only while this row is painted
 				+ SHorizontalBox::Slot()
 				.AutoWidth()
 				.Padding(2.0f)
@@ -100,10 +108,29 @@ TSharedRef<ITableRow> SModulePalette::OnGenerateModuleRow(
 					[
 						SNew(SBorder)
 						.BorderImage(FAppStyle::GetBrush("ToolPanel.DarkGroupBorder"))
+						.Padding(0.0f)
 						[
-							SNew(STextBlock)
-							.Text(FText::FromString(TEXT("?")))
-							.Justification(ETextJustify::Center)
+							SNew(SOverlay)
+
+							+ SOverlay::Slot()
+							.HAlign(HAlign_Center)
+							.VAlign(VAlign_Center)
+							[
+								SNew(STextBlock)
+								.Text(FText::FromString(TEXT("?")))
+								.Justification(ETextJustify::Center)
+								.Visibility_Lambda([ModuleInfoPtr]() {
+									return FModuleThumbnailCache::Get().RequestThumbnail(*ModuleInfoPtr) ? EVisibility::Collapsed : EVisibility::Visible;
+								})
+							]
+
+							+ SOverlay::Slot()
+							[
+								SNew(SImage)
+								.Image_Lambda([ModuleInfoPtr]() {
+									return FModuleThumbnailCache::Get().RequestThumbnail(*ModuleInfoPtr);
+								})
+							]
 						]
 					]
 				]
@@ -153,7 +180,21 @@ FReply SModulePalette::OnModuleDragDetected(const FGeometry& MyGeometry, const F
 void SModulePalette::OnSearchTextChanged(const FText& InFilterText)
 {
 	CurrentSearchText = InFilterText.ToString();
+
+	// Query once typing pauses rather than on every keystroke
+	if (SearchDebounceTimer.IsValid())
+	{
+		UnRegisterActiveTimer(SearchDebounceTimer.ToSharedRef());
+	}
+	SearchDebounceTimer = RegisterActiveTimer(SearchDebounceDelay,
+		FWidgetActiveTimerDelegate::CreateSP(this, &SModulePalette::OnSearchDebounceElapsed));
+}
+
+EActiveTimerReturnType SModulePalette::OnSearchDebounceElapsed(double InCurrentTime, float InDeltaTime)
+{
+	SearchDebounceTimer.Reset();
 	ApplyFilters();
+	return EActiveTimerReturnType::Stop;
 }
 
 void SModulePalette::OnGroupFilterChanged(EStationModuleGroup NewFilter)
@@ -164,28 +205,16 @@ void SModulePalette::OnGroupFilterChanged(EStationModuleGroup NewFilter)
 
 void SModulePalette::ApplyFilters()
 {
-	FilteredModules.Empty();
-
-	for (const TSharedPtr<FModuleInfo>& Module : AllModules)
+	if (CurrentSearchText.IsEmpty())
 	{
-		// Apply group filter
-		if (CurrentGroupFilter != EStationModuleGroup::All &&
-			Module->ModuleGroup != CurrentGroupFilter)
-		{
-			continue;
-		}
-
-		// Apply search filter
-		if (!CurrentSearchText.IsEmpty())
-		{
-			if (!Module->Name.Contains(CurrentSearchText, ESearchCase::IgnoreCase) &&
-				!Module->ModuleType.Contains(CurrentSearchText, ESearchCase::IgnoreCase))
-			{
-				continue;
-			}
-		}
-
-		FilteredModules.Add(Module);
+		// Only the selected group's slice of the catalog is visited
+		const TConstArrayView<TSharedPtr<FModuleInfo>> GroupModules = FModuleDiscovery::DiscoverModulesFiltered(CurrentGroupFilter);
+		FilteredModules.Reset(GroupModules.Num());
+		FilteredModules.Append(GroupModules.GetData(), GroupModules.Num());
+	}
+	else
+	{
+		FModuleDiscoveryService::Get().GetSearchIndex().Query(CurrentSearchText, CurrentGroupFilter, FilteredModules);
 	}
 
 	// Refresh list view
@@ -0,0 +1,176 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ModulePreviewMeshCache.h"
+#include "Editor.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "GameFramework/Actor.h"
+#include "Materials/MaterialInterface.h"
+
+TUniquePtr<FModulePreviewMeshCache> FModulePreviewMeshCache::Instance;
+
+FModulePreviewMeshCache& FModulePreviewMeshCache::Get()
+{
+	if (!Instance.IsValid())
+	{
+		Instance = TUniquePtr<FModulePreviewMeshCache>(new FModulePreviewMeshCache());
+	}
+	return *Instance;
+}
+
+void FModulePreviewMeshCache::Shutdown()
+{
+	Instance.Reset();
+}
+
+FModulePreviewMeshCache::FModulePreviewMeshCache()
+	: Generation(0)
+{
+	if (GEditor)
+	{
+		BlueprintCompiledHandle = GEditor->OnBlueprintCompiled().AddRaw(this, &FModulePreviewMeshCache::HandleBlueprintCompiled);
+	}
+	PackageReloadedHandle = FCoreUObjectDelegates::OnPackageReloaded.AddRaw(this, &FModulePreviewMeshCache::HandlePackageReloaded);
+}
+
+FModulePreviewMeshCache::~FModulePreviewMeshCache()
+{
+	if (GEditor && BlueprintCompiledHandle.IsValid())
+	{
+		GEditor->OnBlueprintCompiled().Remove(BlueprintCompiledHandle);
+	}
+	FCoreUObjectDelegates::OnPackageReloaded.Remove(PackageReloadedHandle);
+}
+
+UStaticMesh* FModulePreviewMeshCache::Resolve(const FSoftClassPath& BlueprintPath, TArray<UMaterialInterface*>& OutMaterials, FBox* OutLocalBounds)
+{
+	OutMaterials.Reset();
+
+	if (BlueprintPath.IsNull())
+	{
+		return nullptr;
+	}
+
+	FEntry* Entry = Entries.Find(BlueprintPath);
+
+	// A hit is only usable if the assets it points at are still alive
+	if (Entry && Entry->bHasMesh && !Entry->Mesh.IsValid())
+	{
+		Entries.Remove(BlueprintPath);
+		Entry = nullptr;
+	}
+
+	if (!Entry)
+	{
+		FEntry NewEntry;
+		if (!BuildEntry(BlueprintPath, NewEntry))
+		{
+			return nullptr; // Class failed to load, try again next time
+		}
+		Entry = &Entries.Add(BlueprintPath, MoveTemp(NewEntry));
+	}
+
+	if (!Entry->bHasMesh)
+	{
+		return nullptr;
+	}
+
+	OutMaterials.Reserve(Entry->Materials.Num());
+	for (const TWeakObjectPtr<UMaterialInterface>& Material : Entry->Materials)
+	{
+		OutMaterials.Add(Material.Get());
+	}
+
+	if (OutLocalBounds)
+	{
+		*OutLocalBounds = Entry->LocalBounds;
+	}
+
+	return Entry->Mesh.Get();
+}
+
+bool FModulePreviewMeshCache::FindLocalBounds(const FSoftClassPath& BlueprintPath, FBox& OutLocalBounds) const
+{
+	const FEntry* Entry = Entries.Find(BlueprintPath);
+	if (!Entry || !Entry->bHasMesh)
+	{
+		return false;
+	}
+
+	OutLocalBounds = Entry->LocalBounds;
+	return true;
+}
+
+bool FModulePreviewMeshCache::IsKnownWithoutMesh(const FSoftClassPath& BlueprintPath) const
+{
+	const FEntry* Entry = Entries.Find(BlueprintPath);
+	return Entry && !Entry->bHasMesh;
+}
+
+void FModulePreviewMeshCache::Invalidate(const FSoftClassPath& BlueprintPath)
+{
+	if (Entries.Remove(BlueprintPath) > 0)
+	{
+		++Generation;
+	}
+}
+
+void FModulePreviewMeshCache::InvalidateAll()
+{
+	Entries.Empty();
+	++Generation;
+}
+
+bool FModulePreviewMeshCache::BuildEntry(const FSoftClassPath& BlueprintPath, FEntry& OutEntry)
+{
+	// Try to load the blueprint and extract the static mesh
+	UClass* BlueprintClass = BlueprintPath.TryLoadClass<UObject>();
+	if (!BlueprintClass)
+	{
+		return false;
+	}
+
+	OutEntry.bHasMesh = false;
+
+	// Get the Class Default Object (CDO) to inspect components
+	AActor* DefaultActor = Cast<AActor>(BlueprintClass->GetDefaultObject());
+	if (!DefaultActor)
+	{
+		return true;
+	}
+
+	// Try to find a static mesh component in the blueprint
+	TArray<UStaticMeshComponent*> MeshComponents;
+	DefaultActor->GetComponents<UStaticMeshComponent>(MeshComponents);
+
+	if (MeshComponents.Num() > 0 && MeshComponents[0]->GetStaticMesh())
+	{
+		UStaticMeshComponent* MeshComponent = MeshComponents[0];
+		UStaticMesh* Mesh = MeshComponent->GetStaticMesh();
+
+		OutEntry.Mesh = Mesh;
+		OutEntry.LocalBounds = Mesh->GetBoundingBox();
+		OutEntry.bHasMesh = true;
+
+		for (int32 i = 0; i < MeshComponent->GetNumMaterials(); ++i)
+		{
+			OutEntry.Materials.Add(MeshComponent->GetMaterial(i));
+		}
+	}
+
+	return true;
+}
+
+void FModulePreviewMeshCache::HandleBlueprintCompiled()
+{
+	// The event does not say which blueprint changed; entries are cheap to rebuild
+	InvalidateAll();
+}
+
+void FModulePreviewMeshCache::HandlePackageReloaded(EPackageReloadPhase Phase, FPackageReloadedEvent* Event)
+{
+	if (Phase == EPackageReloadPhase::PostBatchPostGC && Entries.Num() > 0)
+	{
+		InvalidateAll();
+	}
+}
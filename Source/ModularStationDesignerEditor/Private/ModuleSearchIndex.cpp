@@ -0,0 +1,403 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ModuleSearchIndex.h"
+#include "ModuleDiscoveryService.h"
+
+namespace
+{
+	/** Terms shorter than a trigram are matched as word prefixes through the trie */
+	constexpr int32 TrigramLength = 3;
+
+	/** Tombstones tolerated before the index is compacted */
+	constexpr int32 MinRemovedBeforeCompact = 256;
+
+	/** Trigram hits a candidate needs out of the term's trigram count */
+	int32 GetTrigramThreshold(int32 NumTrigrams)
+	{
+		return FMath::Max(1, (NumTrigrams * 2 + 2) / 3);
+	}
+
+	/** Keep only the ids present in both ascending arrays */
+	void IntersectSorted(TArray<int32>& InOutIds, const TArray<int32>& OtherIds)
+	{
+		int32 Write = 0;
+		int32 OtherIndex = 0;
+		for (int32 Read = 0; Read < InOutIds.Num() && OtherIndex < OtherIds.Num(); ++Read)
+		{
+			while (OtherIndex < OtherIds.Num() && OtherIds[OtherIndex] < InOutIds[Read])
+			{
+				++OtherIndex;
+			}
+			if (OtherIndex < OtherIds.Num() && OtherIds[OtherIndex] == InOutIds[Read])
+			{
+				InOutIds[Write++] = InOutIds[Read];
+			}
+		}
+		InOutIds.SetNum(Write, EAllowShrinking::No);
+	}
+}
+
+FModuleSearchIndex::FModuleSearchIndex()
+	: NumRemoved(0)
+{
+	Reset();
+}
+
+void FModuleSearchIndex::Reset()
+{
+	Entries.Reset();
+	EntryIdByModule.Reset();
+	TrigramPostings.Reset();
+	TrieNodes.Reset();
+	TrieNodes.AddDefaulted(); // Root
+	NumRemoved = 0;
+}
+
+void FModuleSearchIndex::Add(const TSharedPtr<FModuleInfo>& Module)
+{
+	if (!Module.IsValid() || EntryIdByModule.Contains(Module))
+	{
+		return;
+	}
+
+	const int32 EntryId = Entries.AddDefaulted();
+	FEntry& Entry = Entries[EntryId];
+	Entry.Module = Module;
+	Entry.LowerName = Module->Name.ToLower();
+	Entry.LowerType = Module->ModuleType.ToLower();
+	EntryIdByModule.Add(Module, EntryId);
+
+	IndexEntry(EntryId);
+}
+
+bool FModuleSearchIndex::Remove(const TSharedPtr<FModuleInfo>& Module)
+{
+	int32 EntryId;
+	if (!EntryIdByModule.RemoveAndCopyValue(Module, EntryId))
+	{
+		return false;
+	}
+
+	// Tombstone; postings still reference the id until the next compaction
+	Entries[EntryId].Module.Reset();
+	++NumRemoved;
+
+	if (NumRemoved >= MinRemovedBeforeCompact && NumRemoved * 2 > Entries.Num())
+	{
+		Compact();
+	}
+	return true;
+}
+
+void FModuleSearchIndex::ApplyDelta(const FModuleCatalogDelta& Delta)
+{
+	for (const TSharedPtr<FModuleInfo>& Module : Delta.Removed)
+	{
+		Remove(Module);
+	}
+	for (const TSharedPtr<FModuleInfo>& Module : Delta.Added)
+	{
+		Add(Module);
+	}
+}
+
+void FModuleSearchIndex::Query(const FString& SearchText, EStationModuleGroup GroupFilter, TArray<TSharedPtr<FModuleInfo>>& OutResults) const
+{
+	OutResults.Reset();
+
+	TArray<FString> Terms;
+	SearchText.ToLower().ParseIntoArrayWS(Terms);
+	if (Terms.Num() == 0)
+	{
+		return;
+	}
+
+	// Every term has to match
+	TArray<int32> Candidates;
+	TArray<int32> TermCandidates;
+	for (int32 TermIndex = 0; TermIndex < Terms.Num(); ++TermIndex)
+	{
+		FindCandidates(Terms[TermIndex], TermIndex == 0 ? Candidates : TermCandidates);
+		if (TermIndex > 0)
+		{
+			IntersectSorted(Candidates, TermCandidates);
+		}
+		if (Candidates.Num() == 0)
+		{
+			return;
+		}
+	}
+
+	TArray<TPair<float, int32>> Scored;
+	Scored.Reserve(Candidates.Num());
+	for (const int32 EntryId : Candidates)
+	{
+		const FEntry& Entry = Entries[EntryId];
+		if (GroupFilter != EStationModuleGroup::All && Entry.Module->ModuleGroup != GroupFilter)
+		{
+			continue;
+		}
+
+		float Score = 0.0f;
+		for (const FString& Term : Terms)
+		{
+			Score += ScoreTerm(Entry, Term);
+		}
+		Scored.Emplace(Score, EntryId);
+	}
+
+	Scored.Sort([this](const TPair<float, int32>& A, const TPair<float, int32>& B)
+	{
+		if (A.Key != B.Key)
+		{
+			return A.Key > B.Key;
+		}
+		return Entries[A.Value].LowerName < Entries[B.Value].LowerName;
+	});
+
+	OutResults.Reserve(Scored.Num());
+	for (const TPair<float, int32>& Result : Scored)
+	{
+		OutResults.Add(Entries[Result.Value].Module);
+	}
+}
+
+void FModuleSearchIndex::Tokenize(const FString& Text, TArray<FString>& OutWords)
+{
+	OutWords.Reset();
+
+	FString Word;
+	TCHAR Previous = TEXT('\0');
+	for (const TCHAR Char : Text)
+	{
+		const bool bCamelBoundary = FChar::IsUpper(Char) && FChar::IsLower(Previous);
+		if (!FChar::IsAlnum(Char) || bCamelBoundary)
+		{
+			if (!Word.IsEmpty())
+			{
+				OutWords.Add(MoveTemp(Word));
+				Word.Reset();
+			}
+		}
+		if (FChar::IsAlnum(Char))
+		{
+			Word.AppendChar(FChar::ToLower(Char));
+		}
+		Previous = Char;
+	}
+
+	if (!Word.IsEmpty())
+	{
+		OutWords.Add(MoveTemp(Word));
+	}
+}
+
+uint64 FModuleSearchIndex::MakeTrigram(const TCHAR* Chars)
+{
+	return (uint64(Chars[0] & 0x1FFFFF) << 42) | (uint64(Chars[1] & 0x1FFFFF) << 21) | uint64(Chars[2] & 0x1FFFFF);
+}
+
+void FModuleSearchIndex::IndexEntry(int32 EntryId)
+{
+	const FEntry& Entry = Entries[EntryId];
+
+	AddTrigrams(Entry.LowerName, EntryId);
+	AddTrigrams(Entry.LowerType, EntryId);
+
+	TArray<FString> Words;
+	Tokenize(Entry.Module->Name, Words);
+	for (const FString& Word : Words)
+	{
+		AddWord(Word, EntryId);
+	}
+	Tokenize(Entry.Module->ModuleType, Words);
+	for (const FString& Word : Words)
+	{
+		AddWord(Word, EntryId);
+	}
+}
+
+void FModuleSearchIndex::AddTrigrams(const FString& LowerText, int32 EntryId)
+{
+	for (int32 Index = 0; Index + TrigramLength <= LowerText.Len(); ++Index)
+	{
+		// Ids are added in ascending order, so a repeat can only be the last element
+		TArray<int32>& Postings = TrigramPostings.FindOrAdd(MakeTrigram(*LowerText + Index));
+		if (Postings.Num() == 0 || Postings.Last() != EntryId)
+		{
+			Postings.Add(EntryId);
+		}
+	}
+}
+
+void FModuleSearchIndex::AddWord(const FString& Word, int32 EntryId)
+{
+	int32 NodeIndex = 0;
+	for (const TCHAR Char : Word)
+	{
+		int32 ChildIndex = INDEX_NONE;
+		for (const TPair<TCHAR, int32>& Child : TrieNodes[NodeIndex].Children)
+		{
+			if (Child.Key == Char)
+			{
+				ChildIndex = Child.Value;
+				break;
+			}
+		}
+
+		if (ChildIndex == INDEX_NONE)
+		{
+			ChildIndex = TrieNodes.AddDefaulted();
+			TrieNodes[NodeIndex].Children.Emplace(Char, ChildIndex);
+		}
+
+		TArray<int32>& EntryIds = TrieNodes[ChildIndex].EntryIds;
+		if (EntryIds.Num() == 0 || EntryIds.Last() != EntryId)
+		{
+			EntryIds.Add(EntryId);
+		}
+		NodeIndex = ChildIndex;
+	}
+}
+
+int32 FModuleSearchIndex::FindTrieNode(const FString& Prefix) const
+{
+	int32 NodeIndex = 0;
+	for (const TCHAR Char : Prefix)
+	{
+		int32 ChildIndex = INDEX_NONE;
+		for (const TPair<TCHAR, int32>& Child : TrieNodes[NodeIndex].Children)
+		{
+			if (Child.Key == Char)
+			{
+				ChildIndex = Child.Value;
+				break;
+			}
+		}
+
+		if (ChildIndex == INDEX_NONE)
+		{
+			return INDEX_NONE;
+		}
+		NodeIndex = ChildIndex;
+	}
+	return NodeIndex;
+}
+
+void FModuleSearchIndex::FindCandidates(const FString& Term, TArray<int32>& OutCandidates) const
+{
+	OutCandidates.Reset();
+
+	if (Term.Len() < TrigramLength)
+	{
+		const int32 NodeIndex = FindTrieNode(Term);
+		if (NodeIndex != INDEX_NONE)
+		{
+			for (const int32 EntryId : TrieNodes[NodeIndex].EntryIds)
+			{
+				if (Entries[EntryId].Module.IsValid())
+				{
+					OutCandidates.Add(EntryId);
+				}
+			}
+		}
+		return;
+	}
+
+	TArray<uint64> Trigrams;
+	for (int32 Index = 0; Index + TrigramLength <= Term.Len(); ++Index)
+	{
+		Trigrams.AddUnique(MakeTrigram(*Term + Index));
+	}
+
+	// Count trigram hits per entry; only entries touched by the postings are visited
+	if (ScratchHits.Num() < Entries.Num())
+	{
+		ScratchHits.SetNumZeroed(Entries.Num());
+	}
+
+	TArray<int32> Touched;
+	for (const uint64 Trigram : Trigrams)
+	{
+		if (const TArray<int32>* Postings = TrigramPostings.Find(Trigram))
+		{
+			for (const int32 EntryId : *Postings)
+			{
+				if (ScratchHits[EntryId]++ == 0)
+				{
+					Touched.Add(EntryId);
+				}
+			}
+		}
+	}
+
+	const int32 Threshold = GetTrigramThreshold(Trigrams.Num());
+	for (const int32 EntryId : Touched)
+	{
+		if (ScratchHits[EntryId] >= Threshold && Entries[EntryId].Module.IsValid())
+		{
+			OutCandidates.Add(EntryId);
+		}
+		ScratchHits[EntryId] = 0;
+	}
+	OutCandidates.Sort();
+}
+
+float FModuleSearchIndex::ScoreTerm(const FEntry& Entry, const FString& Term) const
+{
+	// Shorter names matching the same term rank higher
+	const float Tightness = 10.0f * Term.Len() / FMath::Max(1, Entry.LowerName.Len());
+
+	const int32 NameIndex = Entry.LowerName.Find(Term, ESearchCase::CaseSensitive);
+	if (NameIndex == 0)
+	{
+		return 100.0f + Tightness;
+	}
+	if (NameIndex > 0)
+	{
+		return 70.0f - FMath::Min(NameIndex, 20) + Tightness;
+	}
+	if (Entry.LowerType.Contains(Term, ESearchCase::CaseSensitive))
+	{
+		return 40.0f;
+	}
+
+	// Fuzzy match: share of the term's trigrams found in the name or type
+	if (Term.Len() < TrigramLength)
+	{
+		return 30.0f; // Word prefix from the trie, e.g. a camelCase word
+	}
+
+	int32 NumTrigrams = 0;
+	int32 NumMatched = 0;
+	for (int32 Index = 0; Index + TrigramLength <= Term.Len(); ++Index)
+	{
+		const FString Trigram = Term.Mid(Index, TrigramLength);
+		++NumTrigrams;
+		if (Entry.LowerName.Contains(Trigram, ESearchCase::CaseSensitive) || Entry.LowerType.Contains(Trigram, ESearchCase::CaseSensitive))
+		{
+			++NumMatched;
+		}
+	}
+	return 30.0f * NumMatched / FMath::Max(1, NumTrigrams);
+}
+
+void FModuleSearchIndex::Compact()
+{
+	TArray<TSharedPtr<FModuleInfo>> LiveModules;
+	LiveModules.Reserve(Num());
+	for (const FEntry& Entry : Entries)
+	{
+		if (Entry.Module.IsValid())
+		{
+			LiveModules.Add(Entry.Module);
+		}
+	}
+
+	Reset();
+	for (const TSharedPtr<FModuleInfo>& Module : LiveModules)
+	{
+		Add(Module);
+	}
+	ScratchHits.Reset();
+}
@@ -0,0 +1,428 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ModuleThumbnailCache.h"
+#include "ModuleCatalogCache.h"
+#include "ModuleDiscoveryService.h"
+#include "ModulePreviewMeshCache.h"
+#include "VisualizationSystem.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Async/Async.h"
+#include "Brushes/SlateDynamicImageBrush.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/ObjectThumbnail.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+#include "ObjectTools.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace
+{
+	/** Brushes kept in memory; about 16 KB of pixels each */
+	constexpr int32 MaxCachedThumbnails = 512;
+
+	/** Workers generating thumbnails at once */
+	constexpr int32 MaxThumbnailsInFlight = 4;
+
+	/** Queued requests not repeated for this many frames belong to rows that scrolled away */
+	constexpr uint64 StaleRequestFrames = 30;
+
+	/** Disk cache file header */
+	constexpr uint32 ThumbnailCacheMagic = 0x4854534D; // 'MSTH'
+	constexpr int32 ThumbnailCacheVersion = 2;
+
+	/** Fraction of the thumbnail the silhouette spans */
+	constexpr float SilhouetteFill = 0.8f;
+}
+
+TUniquePtr<FModuleThumbnailCache> FModuleThumbnailCache::Instance;
+
+FModuleThumbnailCache& FModuleThumbnailCache::Get()
+{
+	if (!Instance.IsValid())
+	{
+		Instance = TUniquePtr<FModuleThumbnailCache>(new FModuleThumbnailCache());
+	}
+	return *Instance;
+}
+
+void FModuleThumbnailCache::Shutdown()
+{
+	Instance.Reset();
+}
+
+FModuleThumbnailCache::FModuleThumbnailCache()
+	: Brushes(MaxCachedThumbnails)
+	, NextJobId(0)
+	, BrushSerial(0)
+{
+	CatalogChangedHandle = FModuleDiscoveryService::Get().OnCatalogChanged().AddRaw(this, &FModuleThumbnailCache::HandleCatalogChanged);
+}
+
+FModuleThumbnailCache::~FModuleThumbnailCache()
+{
+	if (FModuleDiscoveryService::IsAvailable())
+	{
+		FModuleDiscoveryService::Get().OnCatalogChanged().Remove(CatalogChangedHandle);
+	}
+}
+
+const FSlateBrush* FModuleThumbnailCache::RequestThumbnail(const FModuleInfo& Module)
+{
+	if (const TSharedPtr<FSlateBrush>* Brush = Brushes.FindAndTouch(Module.BlueprintPath))
+	{
+		return Brush->Get();
+	}
+
+	// Failed modules stay without a thumbnail until the catalog reports them changed
+	if (!InFlight.Contains(Module.BlueprintPath) && !Failed.Contains(Module.BlueprintPath))
+	{
+		FQueuedRequest& Request = Queued.FindOrAdd(Module.BlueprintPath);
+		Request.Group = Module.ModuleGroup;
+		Request.LastRequestedFrame = GFrameCounter;
+		DispatchQueued();
+	}
+	return nullptr;
+}
+
+void FModuleThumbnailCache::DispatchQueued()
+{
+	while (InFlight.Num() < MaxThumbnailsInFlight && Queued.Num() > 0)
+	{
+		// Most recently painted first; drop rows that are no longer on screen
+		FString NextPath;
+		FQueuedRequest NextRequest;
+		for (auto It = Queued.CreateIterator(); It; ++It)
+		{
+			if (It.Value().LastRequestedFrame + StaleRequestFrames < GFrameCounter)
+			{
+				It.RemoveCurrent();
+			}
+			else if (NextPath.IsEmpty() || It.Value().LastRequestedFrame > NextRequest.LastRequestedFrame)
+			{
+				NextPath = It.Key();
+				NextRequest = It.Value();
+			}
+		}
+
+		if (NextPath.IsEmpty())
+		{
+			return;
+		}
+
+		Queued.Remove(NextPath);
+		const uint32 JobId = ++NextJobId;
+		InFlight.Add(NextPath, JobId);
+
+		FThumbnailJob Job;
+		PrepareJob(NextPath, NextRequest.Group, Job);
+
+		FFunctionGraphTask::CreateAndDispatchWhenReady([Job = MoveTemp(Job), JobId]()
+		{
+			TArray<uint8> Pixels = GenerateThumbnail(Job);
+
+			AsyncTask(ENamedThreads::GameThread, [ObjectPath = Job.ObjectPath, JobId, Pixels = MoveTemp(Pixels)]() mutable
+			{
+				if (FModuleThumbnailCache::IsAvailable())
+				{
+					FModuleThumbnailCache::Get().HandleThumbnailReady(ObjectPath, JobId, MoveTemp(Pixels));
+				}
+			});
+		}, TStatId(), nullptr, ENamedThreads::AnyBackgroundThreadNormalTask);
+	}
+}
+
+void FModuleThumbnailCache::PrepareJob(const FString& ObjectPath, EStationModuleGroup Group, FThumbnailJob& OutJob) const
+{
+	OutJob.ObjectPath = ObjectPath;
+	OutJob.SilhouetteColor = FVisualizationSystem::GetColorForModuleGroup(Group).ToFColor(true);
+
+	// Bounds are only known if the viewport already resolved this Blueprint
+	FModulePreviewMeshCache::Get().FindLocalBounds(FSoftClassPath(ObjectPath), OutJob.SilhouetteBounds);
+
+	const IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	const FAssetData AssetData = AssetRegistry.GetAssetByObjectPath(FSoftObjectPath(ObjectPath));
+	if (!AssetData.IsValid())
+	{
+		return; // Silhouette only
+	}
+
+	OutJob.ObjectFullName = FName(*AssetData.GetFullName());
+	FPackageName::TryConvertLongPackageNameToFilename(AssetData.PackageName.ToString(), OutJob.PackageFilename, FPackageName::GetAssetPackageExtension());
+
+	// One file per Blueprint; the stamp stored inside it invalidates the file when the Blueprint is resaved
+	OutJob.PackageStamp = FModuleCatalogCache::GetPackageStamp(AssetRegistry, AssetData);
+	if (!OutJob.PackageStamp.IsEmpty())
+	{
+		const FString CacheKey = FMD5::HashAnsiString(*ObjectPath);
+		OutJob.DiskCachePath = FPaths::ProjectSavedDir() / TEXT("StationDesigner") / TEXT("Thumbnails") / (CacheKey + TEXT(".thumb"));
+	}
+}
+
+TArray<uint8> FModuleThumbnailCache::GenerateThumbnail(const FThumbnailJob& Job)
+{
+	TArray<uint8> Pixels;
+
+	if (!Job.DiskCachePath.IsEmpty() && LoadFromDiskCache(Job.DiskCachePath, Job.PackageStamp, Pixels))
+	{
+		return Pixels;
+	}
+
+	if (!Job.PackageFilename.IsEmpty() && LoadPackageThumbnail(Job, Pixels))
+	{
+		if (!Job.DiskCachePath.IsEmpty())
+		{
+			SaveToDiskCache(Job.DiskCachePath, Job.PackageStamp, Pixels);
+		}
+		return Pixels;
+	}
+
+	// Silhouettes are cheap and may improve once bounds are known, so they are not persisted
+	DrawSilhouette(Job.SilhouetteBounds, Job.SilhouetteColor, Pixels);
+	return Pixels;
+}
+
+bool FModuleThumbnailCache::LoadFromDiskCache(const FString& CachePath, const FString& PackageStamp, TArray<uint8>& OutBytes)
+{
+	TArray<uint8> FileData;
+	if (!FFileHelper::LoadFileToArray(FileData, *CachePath, FILEREAD_Silent))
+	{
+		return false;
+	}
+
+	FMemoryReader Reader(FileData);
+	uint32 Magic = 0;
+	int32 Version = 0;
+	int32 Size = 0;
+	Reader << Magic << Version << Size;
+	if (Magic != ThumbnailCacheMagic || Version != ThumbnailCacheVersion || Size != ThumbnailSize)
+	{
+		return false;
+	}
+
+	// A stale stamp means the Blueprint was resaved; the caller regenerates and overwrites this file
+	FString StoredStamp;
+	Reader << StoredStamp;
+
+	const int64 NumBytes = int64(ThumbnailSize) * ThumbnailSize * 4;
+	if (Reader.IsError() || StoredStamp != PackageStamp || Reader.TotalSize() - Reader.Tell() != NumBytes)
+	{
+		return false;
+	}
+
+	OutBytes.SetNumUninitialized(NumBytes);
+	Reader.Serialize(OutBytes.GetData(), NumBytes);
+	return !Reader.IsError();
+}
+
+void FModuleThumbnailCache::SaveToDiskCache(const FString& CachePath, const FString& PackageStamp, const TArray<uint8>& Bytes)
+{
+	TArray<uint8> FileData;
+	FMemoryWriter Writer(FileData);
+	uint32 Magic = ThumbnailCacheMagic;
+	int32 Version = ThumbnailCacheVersion;
+	int32 Size = ThumbnailSize;
+	FString StoredStamp = PackageStamp;
+	Writer << Magic << Version << Size << StoredStamp;
+	Writer.Serialize(const_cast<uint8*>(Bytes.GetData()), Bytes.Num());
+
+	if (!FFileHelper::SaveArrayToFile(FileData, *CachePath))
+	{
+		UE_LOG(LogTemp, Verbose, TEXT("Failed to write thumbnail cache: %s"), *CachePath);
+	}
+}
+
+bool FModuleThumbnailCache::LoadPackageThumbnail(const FThumbnailJob& Job, TArray<uint8>& OutBytes)
+{
+	// Reads the thumbnail table from the package file without loading the package
+	TSet<FName> ObjectFullNames;
+	ObjectFullNames.Add(Job.ObjectFullName);
+
+	FThumbnailMap Thumbnails;
+	if (!ThumbnailTools::LoadThumbnailsFromPackage(Job.PackageFilename, ObjectFullNames, Thumbnails))
+	{
+		return false;
+	}
+
+	const FObjectThumbnail* Thumbnail = Thumbnails.Find(Job.ObjectFullName);
+	if (!Thumbnail || Thumbnail->IsEmpty())
+	{
+		return false;
+	}
+
+	const int32 Width = Thumbnail->GetImageWidth();
+	const int32 Height = Thumbnail->GetImageHeight();
+	const TArray<uint8>& ImageData = Thumbnail->GetUncompressedImageData();
+	if (Width <= 0 || Height <= 0 || ImageData.Num() != Width * Height * 4)
+	{
+		return false;
+	}
+
+	Resample(ImageData, Width, Height, OutBytes);
+	return true;
+}
+
+void FModuleThumbnailCache::DrawSilhouette(const FBox& Bounds, const FColor& Color, TArray<uint8>& OutBytes)
+{
+	OutBytes.SetNumZeroed(ThumbnailSize * ThumbnailSize * 4);
+
+	// Unknown bounds draw a cube
+	const FBox Box = Bounds.IsValid ? Bounds : FBox(FVector(-50.0f), FVector(50.0f));
+
+	// Isometric view of the box corners; screen X is view Y, screen up is view Z
+	const FRotator ViewRotation(-30.0f, 45.0f, 0.0f);
+	FVector Vertices[8];
+	Box.GetVertices(Vertices);
+
+	TArray<FVector2D> Points;
+	Points.Reserve(8);
+	FBox2D ScreenBounds(ForceInit);
+	for (const FVector& Vertex : Vertices)
+	{
+		const FVector ViewSpace = ViewRotation.UnrotateVector(Vertex - Box.GetCenter());
+		const FVector2D Point(ViewSpace.Y, -ViewSpace.Z);
+		Points.Add(Point);
+		ScreenBounds += Point;
+	}
+
+	// Convex hull (monotone chain), counter-clockwise in image space
+	Points.Sort([](const FVector2D& A, const FVector2D& B) { return A.X < B.X || (A.X == B.X && A.Y < B.Y); });
+	const auto Cross = [](const FVector2D& O, const FVector2D& A, const FVector2D& B)
+	{
+		return (A.X - O.X) * (B.Y - O.Y) - (A.Y - O.Y) * (B.X - O.X);
+	};
+
+	TArray<FVector2D> Hull;
+	for (int32 Pass = 0; Pass < 2; ++Pass)
+	{
+		const int32 ChainStart = Hull.Num();
+		for (int32 Index = 0; Index < Points.Num(); ++Index)
+		{
+			const FVector2D& Point = Points[Pass == 0 ? Index : Points.Num() - 1 - Index];
+			while (Hull.Num() >= ChainStart + 2 && Cross(Hull[Hull.Num() - 2], Hull.Last(), Point) <= 0.0)
+			{
+				Hull.Pop(EAllowShrinking::No);
+			}
+			Hull.Add(Point);
+		}
+		Hull.Pop(EAllowShrinking::No); // Last point starts the other chain
+	}
+
+	if (Hull.Num() < 3)
+	{
+		return;
+	}
+
+	// Fit the hull into the thumbnail
+	const FVector2D Extent = ScreenBounds.GetSize();
+	const double Scale = SilhouetteFill * ThumbnailSize / FMath::Max(FMath::Max(Extent.X, Extent.Y), UE_KINDA_SMALL_NUMBER);
+	const FVector2D Center = ScreenBounds.GetCenter();
+	for (FVector2D& Point : Hull)
+	{
+		Point = (Point - Center) * Scale + FVector2D(ThumbnailSize * 0.5);
+	}
+
+	for (int32 Y = 0; Y < ThumbnailSize; ++Y)
+	{
+		for (int32 X = 0; X < ThumbnailSize; ++X)
+		{
+			const FVector2D Pixel(X + 0.5, Y + 0.5);
+
+			bool bInside = true;
+			for (int32 Edge = 0; Edge < Hull.Num() && bInside; ++Edge)
+			{
+				bInside = Cross(Hull[Edge], Hull[(Edge + 1) % Hull.Num()], Pixel) >= 0.0;
+			}
+
+			if (bInside)
+			{
+				// Shade top to bottom so the shape reads as a solid
+				const float Shade = FMath::Lerp(1.0f, 0.6f, float(Y) / ThumbnailSize);
+				uint8* Out = &OutBytes[(Y * ThumbnailSize + X) * 4];
+				Out[0] = uint8(Color.B * Shade);
+				Out[1] = uint8(Color.G * Shade);
+				Out[2] = uint8(Color.R * Shade);
+				Out[3] = 255;
+			}
+		}
+	}
+}
+
+void FModuleThumbnailCache::Resample(const TArray<uint8>& Source, int32 SourceWidth, int32 SourceHeight, TArray<uint8>& OutBytes)
+{
+	OutBytes.SetNumUninitialized(ThumbnailSize * ThumbnailSize * 4);
+
+	for (int32 Y = 0; Y < ThumbnailSize; ++Y)
+	{
+		const int32 Y0 = Y * SourceHeight / ThumbnailSize;
+		const int32 Y1 = FMath::Max(Y0 + 1, (Y + 1) * SourceHeight / ThumbnailSize);
+
+		for (int32 X = 0; X < ThumbnailSize; ++X)
+		{
+			const int32 X0 = X * SourceWidth / ThumbnailSize;
+			const int32 X1 = FMath::Max(X0 + 1, (X + 1) * SourceWidth / ThumbnailSize);
+
+			uint32 Sum[4] = { 0, 0, 0, 0 };
+			for (int32 SourceY = Y0; SourceY < Y1; ++SourceY)
+			{
+				const uint8* Row = &Source[(SourceY * SourceWidth + X0) * 4];
+				for (int32 SourceX = X0; SourceX < X1; ++SourceX, Row += 4)
+				{
+					Sum[0] += Row[0];
+					Sum[1] += Row[1];
+					Sum[2] += Row[2];
+					Sum[3] += Row[3];
+				}
+			}
+
+			const uint32 Count = (Y1 - Y0) * (X1 - X0);
+			uint8* Out = &OutBytes[(Y * ThumbnailSize + X) * 4];
+			for (int32 Channel = 0; Channel < 4; ++Channel)
+			{
+				Out[Channel] = uint8(Sum[Channel] / Count);
+			}
+		}
+	}
+}
+
+void FModuleThumbnailCache::HandleThumbnailReady(const FString& ObjectPath, uint32 JobId, TArray<uint8>&& Pixels)
+{
+	// Dropped while generating (module removed or changed), possibly already requested again
+	const uint32* CurrentJobId = InFlight.Find(ObjectPath);
+	if (!CurrentJobId || *CurrentJobId != JobId)
+	{
+		DispatchQueued();
+		return;
+	}
+	InFlight.Remove(ObjectPath);
+
+	// Resource names must be unique, Slate reuses a texture registered under the same name
+	const FName ResourceName(*FString::Printf(TEXT("StationModuleThumbnail_%u"), ++BrushSerial));
+	TSharedPtr<FSlateDynamicImageBrush> Brush = FSlateDynamicImageBrush::CreateWithImageData(
+		ResourceName, FVector2D(ThumbnailSize, ThumbnailSize), Pixels);
+	if (Brush.IsValid())
+	{
+		Brushes.Add(ObjectPath, Brush);
+	}
+	else
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Failed to create module thumbnail: %s"), *ObjectPath);
+		Failed.Add(ObjectPath);
+	}
+
+	DispatchQueued();
+}
+
+void FModuleThumbnailCache::HandleCatalogChanged(const FModuleCatalogDelta& Delta)
+{
+	// A changed module arrives as removed then added, so its thumbnail is regenerated
+	for (const TSharedPtr<FModuleInfo>& Module : Delta.Removed)
+	{
+		Brushes.Remove(Module->BlueprintPath);
+		Queued.Remove(Module->BlueprintPath);
+		InFlight.Remove(Module->BlueprintPath);
+		Failed.Remove(Module->BlueprintPath);
+	}
+}
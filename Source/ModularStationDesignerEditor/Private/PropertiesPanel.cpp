@@ -331,16 +331,87 @@ TSharedRef<SWidget> SPropertiesPanel::CreateValidationResults()
 			.Font(FCoreStyle::GetDefaultFontStyle("Bold", 12))
 		]
 		
-		// Placeholder validation message
+		// Validation messages, replaced by SetValidationResults
 		+ SVerticalBox::Slot()
 		.AutoHeight()
+		[
+			SAssignNew(ValidationMessagesBox, SVerticalBox)
+			
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			.Padding(0.0f, 2.0f)
+			[
+				SNew(STextBlock)
+				.Text(LOCTEXT("ValidationPlaceholder", "Run validation to check for issues"))
+				.Font(FCoreStyle::GetDefaultFontStyle("Italic", 9))
+				.ColorAndOpacity(FLinearColor(0.6f, 0.6f, 0.6f, 1.0f))
+			]
+		];
+}
+
+void SPropertiesPanel::SetValidationResults(const TArray<FValidationMessage>& Messages)
+{
+	if (!ValidationMessagesBox.IsValid())
+	{
+		return;
+	}
+	
+	ValidationMessagesBox->ClearChildren();
+	
+	if (Messages.Num() == 0)
+	{
+		ValidationMessagesBox->AddSlot()
+		.AutoHeight()
 		.Padding(0.0f, 2.0f)
 		[
 			SNew(STextBlock)
-			.Text(LOCTEXT("ValidationPlaceholder", "Run validation to check for issues"))
+			.Text(LOCTEXT("ValidationNoIssues", "No issues found"))
 			.Font(FCoreStyle::GetDefaultFontStyle("Italic", 9))
-			.ColorAndOpacity(FLinearColor(0.6f, 0.6f, 0.6f, 1.0f))
+			.ColorAndOpacity(FLinearColor(0.3f, 0.8f, 0.3f, 1.0f))
+		];
+		return;
+	}
+	
+	for (const FValidationMessage& Message : Messages)
+	{
+		FLinearColor Color = FLinearColor(0.6f, 0.6f, 0.6f, 1.0f);
+		switch (Message.Severity)
+		{
+			case EValidationSeverity::Error:   Color = FLinearColor(0.9f, 0.2f, 0.2f, 1.0f); break;
+			case EValidationSeverity::Warning: Color = FLinearColor(0.9f, 0.7f, 0.1f, 1.0f); break;
+			default: break;
+		}
+		
+		ValidationMessagesBox->AddSlot()
+		.AutoHeight()
+		.Padding(0.0f, 2.0f)
+		[
+			SNew(STextBlock)
+			.Text(FText::FromString(Message.Message))
+			.Font(FCoreStyle::GetDefaultFontStyle("Regular", 9))
+			.ColorAndOpacity(Color)
+			.AutoWrapText(true)
 		];
+	}
+}
+
+void SPropertiesPanel::SetValidationPending()
+{
+	if (!ValidationMessagesBox.IsValid())
+	{
+		return;
+	}
+	
+	ValidationMessagesBox->ClearChildren();
+	ValidationMessagesBox->AddSlot()
+	.AutoHeight()
+	.Padding(0.0f, 2.0f)
+	[
+		SNew(STextBlock)
+		.Text(LOCTEXT("ValidationPending", "Validating..."))
+		.Font(FCoreStyle::GetDefaultFontStyle("Italic", 9))
+		.ColorAndOpacity(FLinearColor(0.6f, 0.6f, 0.6f, 1.0f))
+	];
 }
 
 FText SPropertiesPanel::GetStationName() const
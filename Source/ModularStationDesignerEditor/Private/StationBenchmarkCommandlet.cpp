@@ -0,0 +1,555 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "StationBenchmarkCommandlet.h"
+#include "StationValidator.h"
+#include "VisualizationSystem.h"
+#include "StationFileHelper.h"
+#include "AdvancedTools.h"
+#include "StationModuleGraph.h"
+#include "StationConnectivityTracker.h"
+#include "ModuleDiscoveryService.h"
+#include "ModuleSearchIndex.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Math/RandomStream.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Async/Async.h"
+#include "HAL/PlatformProcess.h"
+#include "JsonObjectConverter.h"
+#include "Policies/PrettyJsonPrintPolicy.h"
+#include "Serialization/JsonWriter.h"
+
+namespace
+{
+	/** Min/mean/max wall time for one benchmarked function */
+	struct FBenchmarkTiming
+	{
+		FString Name;
+		double MinMs = 0.0;
+		double MeanMs = 0.0;
+		double MaxMs = 0.0;
+	};
+
+	template <typename FunctionType>
+	FBenchmarkTiming MeasureFunction(const FString& Name, int32 Iterations, FunctionType&& Function)
+	{
+		FBenchmarkTiming Timing;
+		Timing.Name = Name;
+		Timing.MinMs = TNumericLimits<double>::Max();
+
+		double TotalMs = 0.0;
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			const double StartTime = FPlatformTime::Seconds();
+			Function();
+			const double ElapsedMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+			TotalMs += ElapsedMs;
+			Timing.MinMs = FMath::Min(Timing.MinMs, ElapsedMs);
+			Timing.MaxMs = FMath::Max(Timing.MaxMs, ElapsedMs);
+		}
+		Timing.MeanMs = TotalMs / FMath::Max(1, Iterations);
+
+		UE_LOG(LogTemp, Display, TEXT("  %-28s min %10.3f ms  mean %10.3f ms  max %10.3f ms"),
+			*Name, Timing.MinMs, Timing.MeanMs, Timing.MaxMs);
+		return Timing;
+	}
+
+	/**
+	 * Run a function once while a sampling thread tracks process memory
+	 * @return Peak used physical memory above the starting level, in bytes
+	 */
+	template <typename FunctionType>
+	int64 MeasurePeakMemory(FunctionType&& Function)
+	{
+		const int64 BaselineBytes = FPlatformMemory::GetStats().UsedPhysical;
+		TAtomic<int64> PeakBytes(BaselineBytes);
+		TAtomic<bool> bStop(false);
+
+		TFuture<void> Sampler = Async(EAsyncExecution::Thread, [&PeakBytes, &bStop]()
+		{
+			while (!bStop.Load())
+			{
+				const int64 UsedBytes = FPlatformMemory::GetStats().UsedPhysical;
+				if (UsedBytes > PeakBytes.Load())
+				{
+					PeakBytes.Store(UsedBytes);
+				}
+				FPlatformProcess::Sleep(0.001f);
+			}
+		});
+
+		Function();
+		bStop.Store(true);
+		Sampler.Wait();
+
+		return FMath::Max<int64>(0, FMath::Max(PeakBytes.Load(), int64(FPlatformMemory::GetStats().UsedPhysical)) - BaselineBytes);
+	}
+
+	/** Previous save path: reflect into an FJsonObject tree, then serialize it */
+	bool SaveStationJsonDom(const FStationDesign& Design, const FString& FilePath)
+	{
+		FString JsonString;
+		return FJsonObjectConverter::UStructToJsonObjectString(Design, JsonString) &&
+			FFileHelper::SaveStringToFile(JsonString, *FilePath);
+	}
+
+	/** Previous load path: parse into an FJsonObject tree, then reflect into the struct */
+	bool LoadStationJsonDom(const FString& FilePath, FStationDesign& OutDesign)
+	{
+		FString JsonString;
+		if (!FFileHelper::LoadFileToString(JsonString, *FilePath) ||
+			!FJsonObjectConverter::JsonObjectStringToUStruct(JsonString, &OutDesign, 0, 0))
+		{
+			return false;
+		}
+		OutDesign.RebuildModuleIndex();
+		return true;
+	}
+
+	FSoftClassPath MakeSyntheticBlueprintPath(const TCHAR* AssetName)
+	{
+		return FSoftClassPath(FString::Printf(TEXT("/Game/StationBenchmark/%s.%s_C"), AssetName, AssetName));
+	}
+
+	/** Palette search has to answer within this budget per keystroke */
+	constexpr double SearchBudgetMs = 1.0;
+
+	/** Single queries are short, so each search timing takes at least this many samples */
+	constexpr int32 MinSearchIterations = 50;
+
+	/** Build a catalog delta of synthetic modules named like "BP_HabitationRing_0042" */
+	FModuleCatalogDelta GenerateSyntheticCatalog(int32 NumModules, int32 Seed = 1)
+	{
+		struct FSyntheticKind
+		{
+			const TCHAR* Type;
+			EStationModuleGroup Group;
+		};
+
+		static const FSyntheticKind Kinds[] = {
+			{ TEXT("Docking"), EStationModuleGroup::Docking },
+			{ TEXT("Reactor"), EStationModuleGroup::Power },
+			{ TEXT("Solar"), EStationModuleGroup::Power },
+			{ TEXT("Cargo"), EStationModuleGroup::Storage },
+			{ TEXT("Refinery"), EStationModuleGroup::Processing },
+			{ TEXT("Shield"), EStationModuleGroup::Defence },
+			{ TEXT("Habitation"), EStationModuleGroup::Habitation },
+			{ TEXT("Marketplace"), EStationModuleGroup::Public },
+			{ TEXT("Corridor"), EStationModuleGroup::Connection },
+			{ TEXT("Research"), EStationModuleGroup::Other }
+		};
+		static const TCHAR* Shapes[] = { TEXT("Ring"), TEXT("Bay"), TEXT("Module"), TEXT("Hub"), TEXT("Spire"), TEXT("Node") };
+
+		FRandomStream Random(Seed);
+		FModuleCatalogDelta Delta;
+		Delta.Added.Reserve(NumModules);
+		for (int32 i = 0; i < NumModules; ++i)
+		{
+			const FSyntheticKind& Kind = Kinds[Random.RandRange(0, int32(UE_ARRAY_COUNT(Kinds)) - 1)];
+			const TCHAR* Shape = Shapes[Random.RandRange(0, int32(UE_ARRAY_COUNT(Shapes)) - 1)];
+
+			TSharedPtr<FModuleInfo> Module = MakeShared<FModuleInfo>();
+			Module->Name = FString::Printf(TEXT("BP_%s%s_%04d"), Kind.Type, Shape, i);
+			Module->BlueprintPath = FString::Printf(TEXT("/Game/StationBenchmark/Modules/%s.%s"), *Module->Name, *Module->Name);
+			Module->ModuleType = Kind.Type;
+			Module->ModuleGroup = Kind.Group;
+			Delta.Added.Add(Module);
+		}
+		return Delta;
+	}
+}
+
+UStationBenchmarkCommandlet::UStationBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+FStationDesign UStationBenchmarkCommandlet::GenerateSyntheticDesign(int32 NumModules, int32 Seed)
+{
+	FStationDesign Design;
+	Design.StationName = FString::Printf(TEXT("Benchmark_%d"), NumModules);
+
+	if (NumModules <= 0)
+	{
+		return Design;
+	}
+
+	FRandomStream Random(Seed);
+
+	// Keep the special module counts bounded: power flow and traffic paths are
+	// generator x consumer / docking x destination products
+	const int32 NumDocking = FMath::Clamp(NumModules / 500, 1, 8);
+	const int32 NumReactors = FMath::Clamp(NumModules / 250, 1, 16);
+	const int32 NumMarkets = FMath::Clamp(NumModules / 1000, 1, 8);
+	const int32 NumCargo = FMath::Clamp(NumModules / 1000, 1, 8);
+
+	const FSoftClassPath DockingPath = MakeSyntheticBlueprintPath(TEXT("BP_DockingBay"));
+	const FSoftClassPath ReactorPath = MakeSyntheticBlueprintPath(TEXT("BP_Reactor"));
+	const FSoftClassPath MarketPath = MakeSyntheticBlueprintPath(TEXT("BP_Marketplace"));
+	const FSoftClassPath CargoPath = MakeSyntheticBlueprintPath(TEXT("BP_CargoBay"));
+	const FSoftClassPath HabitationPath = MakeSyntheticBlueprintPath(TEXT("BP_Habitation"));
+	const FSoftClassPath CorridorPath = MakeSyntheticBlueprintPath(TEXT("BP_Corridor"));
+
+	// Lay modules out on a square grid
+	const int32 GridWidth = FMath::CeilToInt(FMath::Sqrt(static_cast<float>(NumModules)));
+	const float Spacing = 500.0f;
+
+	Design.Modules.Reserve(NumModules);
+	for (int32 i = 0; i < NumModules; ++i)
+	{
+		FModulePlacement Module;
+		Module.ModuleID = FGuid::NewDeterministicGuid(FString::Printf(TEXT("%d_%d"), Seed, i)).ToString();
+
+		if (i < NumDocking)
+		{
+			Module.ModuleBlueprintPath = DockingPath;
+		}
+		else if (i < NumDocking + NumReactors)
+		{
+			Module.ModuleBlueprintPath = ReactorPath;
+		}
+		else if (i < NumDocking + NumReactors + NumMarkets)
+		{
+			Module.ModuleBlueprintPath = MarketPath;
+		}
+		else if (i < NumDocking + NumReactors + NumMarkets + NumCargo)
+		{
+			Module.ModuleBlueprintPath = CargoPath;
+		}
+		else
+		{
+			Module.ModuleBlueprintPath = Random.FRand() < 0.5f ? HabitationPath : CorridorPath;
+		}
+
+		Module.ComponentName = Module.ModuleBlueprintPath.GetAssetName();
+		Module.Transform = FTransform(
+			FRotator(0.0f, 90.0f * Random.RandRange(0, 3), 0.0f),
+			FVector((i % GridWidth) * Spacing, (i / GridWidth) * Spacing, 0.0f));
+
+		Design.AddModule(Module);
+	}
+
+	// Random spanning tree keeps every module reachable, plus ~20% extra edges for cycles
+	auto Connect = [&Design](int32 A, int32 B)
+	{
+		Design.Modules[A].ConnectedModuleIDs.AddUnique(Design.Modules[B].ModuleID);
+		Design.Modules[B].ConnectedModuleIDs.AddUnique(Design.Modules[A].ModuleID);
+	};
+
+	for (int32 i = 1; i < NumModules; ++i)
+	{
+		Connect(i, Random.RandRange(FMath::Max(0, i - GridWidth), i - 1));
+	}
+
+	const int32 NumExtraEdges = NumModules / 5;
+	for (int32 Edge = 0; Edge < NumExtraEdges; ++Edge)
+	{
+		const int32 A = Random.RandRange(0, NumModules - 1);
+		const int32 B = FMath::Clamp(A + Random.RandRange(-GridWidth, GridWidth), 0, NumModules - 1);
+		if (A != B)
+		{
+			Connect(A, B);
+		}
+	}
+
+	return Design;
+}
+
+int32 UStationBenchmarkCommandlet::Main(const FString& Params)
+{
+	FString SizesString = TEXT("100,1000,10000");
+	FParse::Value(*Params, TEXT("Sizes="), SizesString);
+
+	int32 Iterations = 3;
+	FParse::Value(*Params, TEXT("Iterations="), Iterations);
+	Iterations = FMath::Max(1, Iterations);
+
+	int32 SearchSize = 10000;
+	FParse::Value(*Params, TEXT("SearchSize="), SearchSize);
+
+	FString OutputPath = FPaths::ProjectSavedDir() / TEXT("StationBenchmark") / TEXT("StationBenchmark.json");
+	FParse::Value(*Params, TEXT("Output="), OutputPath);
+
+	TArray<FString> SizeTokens;
+	SizesString.ParseIntoArray(SizeTokens, TEXT(","), true);
+
+	TArray<int32> Sizes;
+	for (const FString& Token : SizeTokens)
+	{
+		const int32 Size = FCString::Atoi(*Token);
+		if (Size > 0)
+		{
+			Sizes.Add(Size);
+		}
+	}
+
+	if (Sizes.Num() == 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("StationBenchmark: no valid sizes in '%s'"), *SizesString);
+		return 1;
+	}
+
+	const FString ScratchDirectory = FPaths::ProjectSavedDir() / TEXT("StationBenchmark");
+	FPlatformFileManager::Get().GetPlatformFile().CreateDirectoryTree(*ScratchDirectory);
+
+	FString JsonString;
+	TSharedRef<TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>> Writer =
+		TJsonWriterFactory<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>::Create(&JsonString);
+
+	Writer->WriteObjectStart();
+	Writer->WriteValue(TEXT("benchmark"), FString(TEXT("StationDesigner")));
+	Writer->WriteValue(TEXT("timestamp"), FDateTime::UtcNow().ToIso8601());
+	Writer->WriteValue(TEXT("iterations"), Iterations);
+	Writer->WriteArrayStart(TEXT("results"));
+
+	bool bAllRoundTripsOk = true;
+
+	for (const int32 NumModules : Sizes)
+	{
+		UE_LOG(LogTemp, Display, TEXT("StationBenchmark: %d modules"), NumModules);
+
+		const FStationDesign Design = GenerateSyntheticDesign(NumModules);
+		const FString FilePath = ScratchDirectory / FString::Printf(TEXT("Benchmark_%d.station"), NumModules);
+
+		int32 NumConnections = 0;
+		for (const FModulePlacement& Module : Design.Modules)
+		{
+			NumConnections += Module.ConnectedModuleIDs.Num();
+		}
+		NumConnections /= 2;
+
+		TArray<FBenchmarkTiming> Timings;
+
+		// Each run starts from a new revision, as validation does after an edit, so the module graph is rebuilt
+		Timings.Add(MeasureFunction(TEXT("ValidateStation"), Iterations, [&Design]()
+		{
+			Design.MarkModified();
+			FStationValidator::ValidateStation(Design);
+		}));
+
+		// Tracker is built once, as the command manager keeps it current across edits
+		FStationConnectivityTracker Tracker;
+		Tracker.Rebuild(Design);
+		Timings.Add(MeasureFunction(TEXT("ValidateStationIncremental"), Iterations, [&Design, &Tracker]()
+		{
+			Design.MarkModified();
+			Tracker.Refresh(Design);
+			FStationValidator::ValidateStation(Design, Tracker.GetNumComponents() <= 1);
+		}));
+
+		Timings.Add(MeasureFunction(TEXT("BuildModuleGraph"), Iterations, [&Design]()
+		{
+			FStationModuleGraph Graph(Design);
+		}));
+
+		Timings.Add(MeasureFunction(TEXT("GenerateConnectionWires"), Iterations, [&Design]()
+		{
+			FVisualizationSystem::GenerateConnectionWires(Design);
+		}));
+
+		Timings.Add(MeasureFunction(TEXT("GeneratePowerFlowLines"), Iterations, [&Design]()
+		{
+			FVisualizationSystem::GeneratePowerFlowLines(Design);
+		}));
+
+		Timings.Add(MeasureFunction(TEXT("GenerateTrafficPaths"), Iterations, [&Design]()
+		{
+			FVisualizationSystem::GenerateTrafficPaths(Design);
+		}));
+
+		Timings.Add(MeasureFunction(TEXT("SaveStationToFile"), Iterations, [&Design, &FilePath]()
+		{
+			FStationFileHelper::SaveStationToFile(Design, FilePath, false);
+		}));
+
+		FStationDesign LoadedDesign;
+		Timings.Add(MeasureFunction(TEXT("LoadStationFromFile"), Iterations, [&LoadedDesign, &FilePath]()
+		{
+			LoadedDesign = FStationDesign();
+			FStationFileHelper::LoadStationFromFile(FilePath, LoadedDesign);
+		}));
+
+		// Previous FJsonObjectConverter path for comparison with the streaming JSON above
+		const FString DomFilePath = FPaths::ChangeExtension(FilePath, TEXT("")) + TEXT("_Dom.station");
+		Timings.Add(MeasureFunction(TEXT("SaveStationJsonDom"), Iterations, [&Design, &DomFilePath]()
+		{
+			SaveStationJsonDom(Design, DomFilePath);
+		}));
+
+		FStationDesign LoadedDomDesign;
+		Timings.Add(MeasureFunction(TEXT("LoadStationJsonDom"), Iterations, [&LoadedDomDesign, &DomFilePath]()
+		{
+			LoadedDomDesign = FStationDesign();
+			LoadStationJsonDom(DomFilePath, LoadedDomDesign);
+		}));
+
+		// Transient memory of one save/load, streaming against the DOM path
+		FStationDesign MemoryDesign;
+		const int64 StreamSavePeak = MeasurePeakMemory([&Design, &FilePath]() { FStationFileHelper::SaveStationToFile(Design, FilePath, false); });
+		const int64 DomSavePeak = MeasurePeakMemory([&Design, &DomFilePath]() { SaveStationJsonDom(Design, DomFilePath); });
+		const int64 StreamLoadPeak = MeasurePeakMemory([&MemoryDesign, &FilePath]() { FStationFileHelper::LoadStationFromFile(FilePath, MemoryDesign); });
+		MemoryDesign = FStationDesign();
+		const int64 DomLoadPeak = MeasurePeakMemory([&MemoryDesign, &DomFilePath]() { LoadStationJsonDom(DomFilePath, MemoryDesign); });
+		MemoryDesign = FStationDesign();
+
+		UE_LOG(LogTemp, Display, TEXT("  Peak memory: save stream %lld KB / DOM %lld KB, load stream %lld KB / DOM %lld KB"),
+			StreamSavePeak / 1024, DomSavePeak / 1024, StreamLoadPeak / 1024, DomLoadPeak / 1024);
+
+		const FString BinaryFilePath = FPaths::ChangeExtension(FilePath, TEXT("")) + TEXT("_Binary.station");
+		Timings.Add(MeasureFunction(TEXT("SaveStationToBinaryFile"), Iterations, [&Design, &BinaryFilePath]()
+		{
+			FStationFileHelper::SaveStationToBinaryFile(Design, BinaryFilePath);
+		}));
+
+		FStationDesign LoadedBinaryDesign;
+		Timings.Add(MeasureFunction(TEXT("LoadStationFromBinaryFile"), Iterations, [&LoadedBinaryDesign, &BinaryFilePath]()
+		{
+			LoadedBinaryDesign = FStationDesign();
+			FStationFileHelper::LoadStationFromFile(BinaryFilePath, LoadedBinaryDesign);
+		}));
+
+		const bool bRoundTripOk = LoadedDesign.Modules.Num() == Design.Modules.Num() &&
+			LoadedDomDesign.Modules.Num() == Design.Modules.Num() &&
+			LoadedBinaryDesign.Modules.Num() == Design.Modules.Num();
+		bAllRoundTripsOk &= bRoundTripOk;
+
+		Timings.Add(MeasureFunction(TEXT("MirrorModules"), Iterations, [&Design]()
+		{
+			FAdvancedTools::MirrorModules(Design.Modules, FAdvancedTools::EMirrorAxis::X);
+		}));
+
+		Timings.Add(MeasureFunction(TEXT("RotateModules"), Iterations, [&Design]()
+		{
+			FAdvancedTools::RotateModules(Design.Modules, 90.0f);
+		}));
+
+		const int64 FileSize = IFileManager::Get().FileSize(*FilePath);
+		const int64 BinaryFileSize = IFileManager::Get().FileSize(*BinaryFilePath);
+		IFileManager::Get().Delete(*FilePath);
+		IFileManager::Get().Delete(*BinaryFilePath);
+		IFileManager::Get().Delete(*DomFilePath);
+
+		Writer->WriteObjectStart();
+		Writer->WriteValue(TEXT("modules"), NumModules);
+		Writer->WriteValue(TEXT("connections"), NumConnections);
+		Writer->WriteValue(TEXT("fileBytes"), FileSize);
+		Writer->WriteValue(TEXT("binaryFileBytes"), BinaryFileSize);
+		Writer->WriteValue(TEXT("roundTripOk"), bRoundTripOk);
+		Writer->WriteObjectStart(TEXT("peakMemoryBytes"));
+		Writer->WriteValue(TEXT("saveStream"), StreamSavePeak);
+		Writer->WriteValue(TEXT("saveJsonDom"), DomSavePeak);
+		Writer->WriteValue(TEXT("loadStream"), StreamLoadPeak);
+		Writer->WriteValue(TEXT("loadJsonDom"), DomLoadPeak);
+		Writer->WriteObjectEnd();
+		Writer->WriteObjectStart(TEXT("timings"));
+		for (const FBenchmarkTiming& Timing : Timings)
+		{
+			Writer->WriteObjectStart(Timing.Name);
+			Writer->WriteValue(TEXT("minMs"), Timing.MinMs);
+			Writer->WriteValue(TEXT("meanMs"), Timing.MeanMs);
+			Writer->WriteValue(TEXT("maxMs"), Timing.MaxMs);
+			Writer->WriteObjectEnd();
+		}
+		Writer->WriteObjectEnd();
+		Writer->WriteObjectEnd();
+	}
+
+	Writer->WriteArrayEnd();
+
+	// Palette search: one query per keystroke against a catalog of SearchSize modules
+	bool bSearchWithinBudget = true;
+	if (SearchSize > 0)
+	{
+		UE_LOG(LogTemp, Display, TEXT("StationBenchmark: search over %d modules"), SearchSize);
+
+		const FModuleCatalogDelta CatalogDelta = GenerateSyntheticCatalog(SearchSize);
+		FModuleSearchIndex SearchIndex;
+
+		TArray<FBenchmarkTiming> SearchTimings;
+		SearchTimings.Add(MeasureFunction(TEXT("BuildSearchIndex"), Iterations, [&SearchIndex, &CatalogDelta]()
+		{
+			SearchIndex.Reset();
+			SearchIndex.ApplyDelta(CatalogDelta);
+		}));
+
+		// Short terms go through the prefix trie, longer ones through trigram postings
+		struct FSearchCase
+		{
+			const TCHAR* Name;
+			const TCHAR* Text;
+		};
+
+		static const FSearchCase SearchCases[] = {
+			{ TEXT("QueryShort"), TEXT("ha") },
+			{ TEXT("QueryLong"), TEXT("habitation ring") },
+			{ TEXT("QueryTypo"), TEXT("habitaton") }
+		};
+
+		const int32 SearchIterations = FMath::Max(Iterations, MinSearchIterations);
+		TArray<TSharedPtr<FModuleInfo>> SearchResults;
+		for (const FSearchCase& SearchCase : SearchCases)
+		{
+			const FString SearchText = SearchCase.Text;
+			const FBenchmarkTiming Timing = MeasureFunction(SearchCase.Name, SearchIterations, [&SearchIndex, &SearchText, &SearchResults]()
+			{
+				SearchIndex.Query(SearchText, EStationModuleGroup::All, SearchResults);
+			}));
+
+			// Min is the steady-state cost; mean and max also carry scheduler noise
+			if (Timing.MinMs > SearchBudgetMs || SearchResults.Num() == 0)
+			{
+				UE_LOG(LogTemp, Error, TEXT("StationBenchmark: '%s' took %.3f ms with %d results (budget %.1f ms)"),
+					*SearchText, Timing.MinMs, SearchResults.Num(), SearchBudgetMs);
+				bSearchWithinBudget = false;
+			}
+			SearchTimings.Add(Timing);
+		}
+
+		Writer->WriteObjectStart(TEXT("search"));
+		Writer->WriteValue(TEXT("modules"), SearchSize);
+		Writer->WriteValue(TEXT("budgetMs"), SearchBudgetMs);
+		Writer->WriteValue(TEXT("withinBudget"), bSearchWithinBudget);
+		Writer->WriteObjectStart(TEXT("timings"));
+		for (const FBenchmarkTiming& Timing : SearchTimings)
+		{
+			Writer->WriteObjectStart(Timing.Name);
+			Writer->WriteValue(TEXT("minMs"), Timing.MinMs);
+			Writer->WriteValue(TEXT("meanMs"), Timing.MeanMs);
+			Writer->WriteValue(TEXT("maxMs"), Timing.MaxMs);
+			Writer->WriteObjectEnd();
+		}
+		Writer->WriteObjectEnd();
+		Writer->WriteObjectEnd();
+	}
+
+	Writer->WriteObjectEnd();
+	Writer->Close();
+
+	if (!FFileHelper::SaveStringToFile(JsonString, *OutputPath))
+	{
+		UE_LOG(LogTemp, Error, TEXT("StationBenchmark: failed to write results to %s"), *OutputPath);
+		return 1;
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("StationBenchmark: results written to %s"), *OutputPath);
+
+	if (!bAllRoundTripsOk)
+	{
+		UE_LOG(LogTemp, Error, TEXT("StationBenchmark: save/load round trip lost modules"));
+		return 1;
+	}
+
+	if (!bSearchWithinBudget)
+	{
+		UE_LOG(LogTemp, Error, TEXT("StationBenchmark: palette search missed its per-keystroke budget"));
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,391 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "StationBinaryFormat.h"
+#include "StationFileMetadata.h"
+#include "HAL/PlatformFileManager.h"
+#include "Async/MappedFileHandle.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+static_assert(PLATFORM_LITTLE_ENDIAN, "The binary station format is read in place and assumes a little-endian host");
+
+namespace
+{
+	/** On-disk header, followed by the sections it points at */
+	struct FBinaryHeader
+	{
+		uint32 Magic;
+		uint16 Version;
+		uint16 HeaderSize;
+		uint32 ModuleCount;
+		uint32 StringCount;
+		uint32 ConnectionCount;
+		uint32 StationNameString;
+		uint32 DesignVersionString;
+		uint32 MetadataSize;
+		uint64 StringOffsetsOffset;
+		uint64 StringDataOffset;
+		uint64 StringDataSize;
+		uint64 ModulesOffset;
+		uint64 ConnectionOffsetsOffset;
+		uint64 ConnectionTargetsOffset;
+	};
+
+	/** On-disk module record */
+	struct FBinaryModule
+	{
+		uint32 ModuleIDString;
+		uint32 BlueprintPathString;
+		uint32 ComponentNameString;
+		float Location[3];
+		float Rotation[4];
+		float Scale[3];
+	};
+
+	/** Fixed part of the metadata block, followed by the name and version as UTF-8 */
+	struct FBinaryMetadata
+	{
+		uint64 ContentHash;
+		uint32 StationNameBytes;
+		uint32 DesignVersionBytes;
+	};
+
+	/** Oldest version this build reads; version 1 has no metadata block */
+	constexpr uint16 MinReadableVersion = 1;
+	constexpr uint16 FirstVersionWithMetadata = 2;
+
+	static_assert(sizeof(FBinaryHeader) == 80, "Binary station header layout changed");
+	static_assert(sizeof(FBinaryMetadata) == 16, "Binary station metadata layout changed");
+	static_assert(sizeof(FBinaryModule) == 52, "Binary station module layout changed");
+
+	/** Case-sensitive keys, module IDs that differ only in case are distinct */
+	struct FCaseSensitiveStringKeyFuncs : BaseKeyFuncs<TPair<FString, uint32>, FString, false>
+	{
+		static const FString& GetSetKey(const TPair<FString, uint32>& Element) { return Element.Key; }
+		static bool Matches(const FString& A, const FString& B) { return A.Equals(B, ESearchCase::CaseSensitive); }
+		static uint32 GetKeyHash(const FString& Key) { return FCrc::StrCrc32(*Key); }
+	};
+
+	/** Builds the deduplicated string table while writing */
+	class FStringTableBuilder
+	{
+	public:
+		uint32 Add(const FString& String)
+		{
+			if (const uint32* Existing = Indices.Find(String))
+			{
+				return *Existing;
+			}
+
+			const uint32 Index = Offsets.Num();
+			Offsets.Add(Blob.Num());
+			const FTCHARToUTF8 Utf8(*String, String.Len());
+			Blob.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+			Indices.Add(String, Index);
+			return Index;
+		}
+
+		TArray<uint32> Offsets;
+		TArray<uint8> Blob;
+
+	private:
+		TMap<FString, uint32, FDefaultSetAllocator, FCaseSensitiveStringKeyFuncs> Indices;
+	};
+
+	uint64 AlignSection(uint64 Offset)
+	{
+		return Align(Offset, 8);
+	}
+
+	/** Append raw bytes at an aligned offset, returning that offset */
+	uint64 AppendSection(TArray<uint8>& Buffer, const void* Data, int64 Size)
+	{
+		const uint64 Offset = AlignSection(Buffer.Num());
+		Buffer.SetNumZeroed(Offset);
+		Buffer.Append(static_cast<const uint8*>(Data), Size);
+		return Offset;
+	}
+
+	/** Check that [Offset, Offset + Size) lies inside the file and is 4-byte aligned */
+	bool IsValidSection(uint64 Offset, uint64 Size, int64 DataSize)
+	{
+		return Offset % 4 == 0 && Offset <= uint64(DataSize) && Size <= uint64(DataSize) - Offset;
+	}
+}
+
+bool FStationBinaryFormat::Save(const FStationDesign& Design, const FString& FilePath)
+{
+	FStringTableBuilder Strings;
+	const uint32 StationNameString = Strings.Add(Design.StationName);
+	const uint32 DesignVersionString = Strings.Add(Design.DesignVersion);
+
+	TArray<FBinaryModule> Modules;
+	Modules.SetNumUninitialized(Design.Modules.Num());
+
+	TArray<uint32> ConnectionOffsets;
+	ConnectionOffsets.Reserve(Design.Modules.Num() + 1);
+	TArray<uint32> ConnectionTargets;
+
+	for (int32 Index = 0; Index < Design.Modules.Num(); ++Index)
+	{
+		const FModulePlacement& Module = Design.Modules[Index];
+		FBinaryModule& Record = Modules[Index];
+
+		Record.ModuleIDString = Strings.Add(Module.ModuleID);
+		Record.BlueprintPathString = Strings.Add(Module.ModuleBlueprintPath.ToString());
+		Record.ComponentNameString = Strings.Add(Module.ComponentName);
+
+		const FVector Location = Module.Transform.GetLocation();
+		const FQuat Rotation = Module.Transform.GetRotation();
+		const FVector Scale = Module.Transform.GetScale3D();
+		Record.Location[0] = float(Location.X);
+		Record.Location[1] = float(Location.Y);
+		Record.Location[2] = float(Location.Z);
+		Record.Rotation[0] = float(Rotation.X);
+		Record.Rotation[1] = float(Rotation.Y);
+		Record.Rotation[2] = float(Rotation.Z);
+		Record.Rotation[3] = float(Rotation.W);
+		Record.Scale[0] = float(Scale.X);
+		Record.Scale[1] = float(Scale.Y);
+		Record.Scale[2] = float(Scale.Z);
+
+		ConnectionOffsets.Add(ConnectionTargets.Num());
+		for (const FString& ConnectedID : Module.ConnectedModuleIDs)
+		{
+			ConnectionTargets.Add(Strings.Add(ConnectedID));
+		}
+	}
+	ConnectionOffsets.Add(ConnectionTargets.Num());
+	Strings.Offsets.Add(Strings.Blob.Num());
+
+	FBinaryHeader Header;
+	FMemory::Memzero(Header);
+	Header.Magic = Magic;
+	Header.Version = Version;
+	Header.HeaderSize = sizeof(FBinaryHeader);
+	Header.ModuleCount = Modules.Num();
+	Header.StringCount = Strings.Offsets.Num() - 1;
+	Header.ConnectionCount = ConnectionTargets.Num();
+	Header.StationNameString = StationNameString;
+	Header.DesignVersionString = DesignVersionString;
+
+	// Metadata block right after the header
+	const FTCHARToUTF8 NameUtf8(*Design.StationName, Design.StationName.Len());
+	const FTCHARToUTF8 VersionUtf8(*Design.DesignVersion, Design.DesignVersion.Len());
+	FBinaryMetadata Metadata;
+	Metadata.ContentHash = FStationFileMetadata::ComputeContentHash(Design);
+	Metadata.StationNameBytes = NameUtf8.Length();
+	Metadata.DesignVersionBytes = VersionUtf8.Length();
+	Header.MetadataSize = sizeof(FBinaryMetadata) + Metadata.StationNameBytes + Metadata.DesignVersionBytes;
+
+	TArray<uint8> Buffer;
+	Buffer.Reserve(sizeof(FBinaryHeader) + Header.MetadataSize + Strings.Blob.Num() + Strings.Offsets.Num() * sizeof(uint32) +
+		Modules.Num() * sizeof(FBinaryModule) + (ConnectionOffsets.Num() + ConnectionTargets.Num()) * sizeof(uint32) + 64);
+	Buffer.AddZeroed(sizeof(FBinaryHeader));
+	Buffer.Append(reinterpret_cast<const uint8*>(&Metadata), sizeof(FBinaryMetadata));
+	Buffer.Append(reinterpret_cast<const uint8*>(NameUtf8.Get()), NameUtf8.Length());
+	Buffer.Append(reinterpret_cast<const uint8*>(VersionUtf8.Get()), VersionUtf8.Length());
+
+	Header.StringOffsetsOffset = AppendSection(Buffer, Strings.Offsets.GetData(), Strings.Offsets.Num() * sizeof(uint32));
+	Header.StringDataOffset = AppendSection(Buffer, Strings.Blob.GetData(), Strings.Blob.Num());
+	Header.StringDataSize = Strings.Blob.Num();
+	Header.ModulesOffset = AppendSection(Buffer, Modules.GetData(), Modules.Num() * sizeof(FBinaryModule));
+	Header.ConnectionOffsetsOffset = AppendSection(Buffer, ConnectionOffsets.GetData(), ConnectionOffsets.Num() * sizeof(uint32));
+	Header.ConnectionTargetsOffset = AppendSection(Buffer, ConnectionTargets.GetData(), ConnectionTargets.Num() * sizeof(uint32));
+	FMemory::Memcpy(Buffer.GetData(), &Header, sizeof(FBinaryHeader));
+
+	if (!FFileHelper::SaveArrayToFile(Buffer, *FilePath))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to save binary station file: %s"), *FilePath);
+		return false;
+	}
+	return true;
+}
+
+bool FStationBinaryFormat::Load(const FString& FilePath, FStationDesign& OutDesign)
+{
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+	// Read the sections straight out of a mapping; fall back to one read where mapping is unsupported
+	TUniquePtr<IMappedFileHandle> MappedFile(PlatformFile.OpenMapped(*FilePath));
+	if (MappedFile.IsValid() && MappedFile->GetFileSize() > 0)
+	{
+		TUniquePtr<IMappedFileRegion> Region(MappedFile->MapRegion(0, MappedFile->GetFileSize()));
+		if (Region.IsValid())
+		{
+			return LoadFromMemory(Region->GetMappedPtr(), Region->GetMappedSize(), OutDesign);
+		}
+	}
+
+	TArray<uint8> FileData;
+	if (!FFileHelper::LoadFileToArray(FileData, *FilePath))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to load binary station file: %s"), *FilePath);
+		return false;
+	}
+	return LoadFromMemory(FileData.GetData(), FileData.Num(), OutDesign);
+}
+
+bool FStationBinaryFormat::ReadMetadata(const FString& FilePath, FStationFileMetadata& OutMetadata)
+{
+	TUniquePtr<IFileHandle> File(FPlatformFileManager::Get().GetPlatformFile().OpenRead(*FilePath));
+	if (!File.IsValid())
+	{
+		return false;
+	}
+
+	FBinaryHeader Header;
+	if (!File->Read(reinterpret_cast<uint8*>(&Header), sizeof(FBinaryHeader)) ||
+		Header.Magic != Magic || Header.Version < FirstVersionWithMetadata || Header.Version > Version ||
+		Header.HeaderSize != sizeof(FBinaryHeader) || Header.MetadataSize < sizeof(FBinaryMetadata) ||
+		Header.MetadataSize > File->Size() - sizeof(FBinaryHeader))
+	{
+		return false;
+	}
+
+	TArray<uint8> Block;
+	Block.SetNumUninitialized(Header.MetadataSize);
+	if (!File->Read(Block.GetData(), Block.Num()))
+	{
+		return false;
+	}
+
+	FBinaryMetadata Metadata;
+	FMemory::Memcpy(&Metadata, Block.GetData(), sizeof(FBinaryMetadata));
+	if (uint64(sizeof(FBinaryMetadata)) + Metadata.StationNameBytes + Metadata.DesignVersionBytes > Header.MetadataSize)
+	{
+		return false;
+	}
+
+	const UTF8CHAR* Text = reinterpret_cast<const UTF8CHAR*>(Block.GetData() + sizeof(FBinaryMetadata));
+	const FUTF8ToTCHAR Name(Text, Metadata.StationNameBytes);
+	const FUTF8ToTCHAR DesignVersion(Text + Metadata.StationNameBytes, Metadata.DesignVersionBytes);
+
+	OutMetadata.StationName = FString(Name.Length(), Name.Get());
+	OutMetadata.DesignVersion = FString(DesignVersion.Length(), DesignVersion.Get());
+	OutMetadata.ModuleCount = Header.ModuleCount;
+	OutMetadata.ContentHash = Metadata.ContentHash;
+	return true;
+}
+
+bool FStationBinaryFormat::IsBinaryFile(const FString& FilePath)
+{
+	TUniquePtr<IFileHandle> File(FPlatformFileManager::Get().GetPlatformFile().OpenRead(*FilePath));
+	uint32 FileMagic = 0;
+	return File.IsValid() && File->Read(reinterpret_cast<uint8*>(&FileMagic), sizeof(FileMagic)) && FileMagic == Magic;
+}
+
+bool FStationBinaryFormat::LoadFromMemory(const uint8* Data, int64 DataSize, FStationDesign& OutDesign)
+{
+	if (!Data || DataSize < int64(sizeof(FBinaryHeader)))
+	{
+		return false;
+	}
+
+	FBinaryHeader Header;
+	FMemory::Memcpy(&Header, Data, sizeof(FBinaryHeader));
+	if (Header.Magic != Magic || Header.Version < MinReadableVersion || Header.Version > Version || Header.HeaderSize != sizeof(FBinaryHeader))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Unsupported binary station file (version %d)"), Header.Version);
+		return false;
+	}
+
+	// Validate every section before touching it
+	const uint64 NumStringOffsets = uint64(Header.StringCount) + 1;
+	const uint64 NumConnectionOffsets = uint64(Header.ModuleCount) + 1;
+	if (!IsValidSection(Header.StringOffsetsOffset, NumStringOffsets * sizeof(uint32), DataSize) ||
+		!IsValidSection(Header.StringDataOffset, Header.StringDataSize, DataSize) ||
+		!IsValidSection(Header.ModulesOffset, uint64(Header.ModuleCount) * sizeof(FBinaryModule), DataSize) ||
+		!IsValidSection(Header.ConnectionOffsetsOffset, NumConnectionOffsets * sizeof(uint32), DataSize) ||
+		!IsValidSection(Header.ConnectionTargetsOffset, uint64(Header.ConnectionCount) * sizeof(uint32), DataSize) ||
+		Header.StationNameString >= Header.StringCount || Header.DesignVersionString >= Header.StringCount)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Corrupt binary station file: section out of range"));
+		return false;
+	}
+
+	const uint32* StringOffsets = reinterpret_cast<const uint32*>(Data + Header.StringOffsetsOffset);
+	const UTF8CHAR* StringData = reinterpret_cast<const UTF8CHAR*>(Data + Header.StringDataOffset);
+	const FBinaryModule* Modules = reinterpret_cast<const FBinaryModule*>(Data + Header.ModulesOffset);
+	const uint32* ConnectionOffsets = reinterpret_cast<const uint32*>(Data + Header.ConnectionOffsetsOffset);
+	const uint32* ConnectionTargets = reinterpret_cast<const uint32*>(Data + Header.ConnectionTargetsOffset);
+
+	// Decode each string once
+	TArray<FString> Strings;
+	Strings.SetNum(Header.StringCount);
+	for (uint32 Index = 0; Index < Header.StringCount; ++Index)
+	{
+		const uint32 Start = StringOffsets[Index];
+		const uint32 End = StringOffsets[Index + 1];
+		if (Start > End || End > Header.StringDataSize)
+		{
+			UE_LOG(LogTemp, Error, TEXT("Corrupt binary station file: bad string table"));
+			return false;
+		}
+
+		const FUTF8ToTCHAR Converted(StringData + Start, End - Start);
+		Strings[Index] = FString(Converted.Length(), Converted.Get());
+	}
+
+	if (ConnectionOffsets[0] != 0 || ConnectionOffsets[Header.ModuleCount] != Header.ConnectionCount)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Corrupt binary station file: bad connection offsets"));
+		return false;
+	}
+
+	OutDesign.StationName = Strings[Header.StationNameString];
+	OutDesign.DesignVersion = Strings[Header.DesignVersionString];
+	OutDesign.Modules.Reset();
+	OutDesign.Modules.SetNum(Header.ModuleCount);
+
+	// Blueprint paths repeat across modules, parse each distinct one once
+	TMap<uint32, FSoftClassPath> BlueprintPaths;
+
+	for (uint32 Index = 0; Index < Header.ModuleCount; ++Index)
+	{
+		const FBinaryModule& Record = Modules[Index];
+		const uint32 ConnectionStart = ConnectionOffsets[Index];
+		const uint32 ConnectionEnd = ConnectionOffsets[Index + 1];
+		if (Record.ModuleIDString >= Header.StringCount ||
+			Record.BlueprintPathString >= Header.StringCount ||
+			Record.ComponentNameString >= Header.StringCount ||
+			ConnectionStart > ConnectionEnd || ConnectionEnd > Header.ConnectionCount)
+		{
+			UE_LOG(LogTemp, Error, TEXT("Corrupt binary station file: bad module record %u"), Index);
+			OutDesign.Modules.Reset();
+			return false;
+		}
+
+		FModulePlacement& Module = OutDesign.Modules[Index];
+		Module.ModuleID = Strings[Record.ModuleIDString];
+		Module.ComponentName = Strings[Record.ComponentNameString];
+
+		FSoftClassPath* BlueprintPath = BlueprintPaths.Find(Record.BlueprintPathString);
+		if (!BlueprintPath)
+		{
+			BlueprintPath = &BlueprintPaths.Add(Record.BlueprintPathString, FSoftClassPath(Strings[Record.BlueprintPathString]));
+		}
+		Module.ModuleBlueprintPath = *BlueprintPath;
+
+		Module.Transform = FTransform(
+			FQuat(Record.Rotation[0], Record.Rotation[1], Record.Rotation[2], Record.Rotation[3]),
+			FVector(Record.Location[0], Record.Location[1], Record.Location[2]),
+			FVector(Record.Scale[0], Record.Scale[1], Record.Scale[2]));
+
+		Module.ConnectedModuleIDs.Reserve(ConnectionEnd - ConnectionStart);
+		for (uint32 Connection = ConnectionStart; Connection < ConnectionEnd; ++Connection)
+		{
+			const uint32 TargetString = ConnectionTargets[Connection];
+			if (TargetString >= Header.StringCount)
+			{
+				UE_LOG(LogTemp, Error, TEXT("Corrupt binary station file: bad connection in module %u"), Index);
+				OutDesign.Modules.Reset();
+				return false;
+			}
+			Module.ConnectedModuleIDs.Add(Strings[TargetString]);
+		}
+	}
+
+	OutDesign.RebuildModuleIndex();
+	return true;
+}
@@ -11,6 +11,7 @@ void FStationCommandManager::ExecuteCommand(TSharedPtr<IStationCommand> Command,
 	
 	// Execute the command
 	Command->Execute(Design);
+	Command->UpdateConnectivity(ConnectivityTracker, false);
 	
 	// Add to undo stack
 	UndoStack.Add(Command);
@@ -39,6 +40,7 @@ bool FStationCommandManager::Undo(FStationDesign& Design)
 	
 	// Undo the command
 	Command->Undo(Design);
+	Command->UpdateConnectivity(ConnectivityTracker, true);
 	
 	// Add to redo stack
 	RedoStack.Add(Command);
@@ -59,6 +61,7 @@ bool FStationCommandManager::Redo(FStationDesign& Design)
 	
 	// Re-execute the command
 	Command->Execute(Design);
+	Command->UpdateConnectivity(ConnectivityTracker, false);
 	
 	// Add back to undo stack
 	UndoStack.Add(Command);
@@ -5,6 +5,7 @@
 #include "StationViewport.h"
 #include "PropertiesPanel.h"
 #include "StationFileHelper.h"
+#include "StationValidationService.h"
 #include "Widgets/Layout/SBorder.h"
 #include "Widgets/Layout/SBox.h"
 #include "Widgets/Layout/SSplitter.h"
@@ -20,6 +21,9 @@ void SStationDesignerWindow::Construct(const FArguments& InArgs)
 	// Initialize design
 	CurrentDesign = FStationDesign();
 
+	ValidationService = MakeShared<FStationValidationService>();
+	ValidationService->OnValidationComplete().BindSP(this, &SStationDesignerWindow::OnValidationComplete);
+
 	ChildSlot
 	[
 		SNew(SVerticalBox)
@@ -221,6 +225,8 @@ TSharedRef<SWidget> SStationDesignerWindow::CreateViewportPanel()
 			[
 				SAssignNew(StationViewport, SStationViewport)
 				.StationDesign(&CurrentDesign)
+				.CommandManager(&CommandManager)
+				.OnDesignChanged(this, &SStationDesignerWindow::OnDesignChanged)
 			]
 		];
 }
@@ -255,7 +261,9 @@ TSharedRef<SWidget> SStationDesignerWindow::CreatePropertiesPanel()
 FReply SStationDesignerWindow::OnNewStation()
 {
 	CurrentDesign = FStationDesign();
+	ResetCommandHistory();
 	UpdateUI();
+	RequestValidation();
 	UE_LOG(LogTemp, Log, TEXT("New station created"));
 	return FReply::Handled();
 }
@@ -328,8 +336,8 @@ FReply SStationDesignerWindow::OnExportStation()
 
 FReply SStationDesignerWindow::OnValidateStation()
 {
-	// TODO: Implement validation using FStationValidator
-	UE_LOG(LogTemp, Log, TEXT("Validate station clicked - Validation not yet implemented"));
+	RequestValidation();
+	UE_LOG(LogTemp, Log, TEXT("Validate station clicked"));
 	return FReply::Handled();
 }
 
@@ -357,6 +365,43 @@ void SStationDesignerWindow::UpdateUI()
 	}
 }
 
+void SStationDesignerWindow::OnDesignChanged()
+{
+	UpdateUI();
+	RequestValidation();
+}
+
+void SStationDesignerWindow::RequestValidation()
+{
+	if (!ValidationService.IsValid())
+	{
+		return;
+	}
+	
+	// Snapshot is taken here; the validator itself runs on a worker thread
+	ValidationService->RequestValidation(CurrentDesign, &CommandManager.GetConnectivityTracker());
+	
+	if (PropertiesPanel.IsValid())
+	{
+		PropertiesPanel->SetValidationPending();
+	}
+}
+
+void SStationDesignerWindow::ResetCommandHistory()
+{
+	// The design was replaced wholesale, so neither the history nor the tracker applies to it
+	CommandManager.ClearHistory();
+	CommandManager.GetConnectivityTracker().Invalidate();
+}
+
+void SStationDesignerWindow::OnValidationComplete(const TArray<FValidationMessage>& Messages)
+{
+	if (PropertiesPanel.IsValid())
+	{
+		PropertiesPanel->SetValidationResults(Messages);
+	}
+}
+
 void SStationDesignerWindow::SaveStationToFile(const FString& FilePath)
 {
 	// Delegate to FStationFileHelper to avoid duplication
@@ -375,7 +420,9 @@ void SStationDesignerWindow::LoadStationFromFile(const FString& FilePath)
 	// Delegate to FStationFileHelper to avoid duplication
 	if (FStationFileHelper::LoadStationFromFile(FilePath, CurrentDesign))
 	{
+		ResetCommandHistory();
 		UpdateUI();
+		RequestValidation();
 		UE_LOG(LogTemp, Log, TEXT("Station loaded successfully from: %s"), *FilePath);
 	}
 	else
@@ -69,7 +69,13 @@ bool FStationExporter::LoadDesignFromFile(const FString& FilePath, FStationDesig
 	}
 
 	// Parse JSON
-	return FJsonObjectConverter::JsonObjectStringToUStruct(JsonString, &OutDesign, 0, 0);
+	if (!FJsonObjectConverter::JsonObjectStringToUStruct(JsonString, &OutDesign, 0, 0))
+	{
+		return false;
+	}
+	
+	OutDesign.RebuildModuleIndex();
+	return true;
 }
 
 UBlueprint* FStationExporter::CreateBlueprintAsset(const FString& PackagePath, const FString& AssetName)
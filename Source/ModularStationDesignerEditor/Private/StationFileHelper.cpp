@@ -1,11 +1,12 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "StationFileHelper.h"
+#include "StationBinaryFormat.h"
+#include "StationJsonStream.h"
+#include "StationLibraryIndex.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
 #include "HAL/PlatformFileManager.h"
-#include "Json.h"
-#include "JsonUtilities.h"
 
 bool FStationFileHelper::SaveStationToFile(const FStationDesign& Design, const FString& FilePath, bool bPrettyPrint)
 {
@@ -13,40 +14,30 @@ bool FStationFileHelper::SaveStationToFile(const FStationDesign& Design, const F
 	FString Directory = FPaths::GetPath(FilePath);
 	EnsureDirectoryExists(Directory);
 	
-	// Convert to JSON
-	FString JsonString;
-	if (bPrettyPrint)
+	// Stream JSON straight to the file, no FJsonObject tree
+	if (!FStationJsonStream::SaveToFile(Design, FilePath, bPrettyPrint))
 	{
-		// Pretty print with indentation
-		TSharedPtr<FJsonObject> JsonObject;
-		if (!FJsonObjectConverter::UStructToJsonObject<FStationDesign>(Design, JsonObject) || !JsonObject.IsValid() || JsonObject->Values.Num() == 0)
-		{
-			UE_LOG(LogTemp, Error, TEXT("Failed to serialize station design to JSON (pretty print)"));
-			return false;
-		}
-
-		TSharedRef<TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>> JsonWriter =
-			TJsonWriterFactory<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>::Create(&JsonString);
-		FJsonSerializer::Serialize(JsonObject.ToSharedRef(), JsonWriter);
-	}
-	else
-	{
-		// Compact JSON
-		if (!FJsonObjectConverter::UStructToJsonObjectString<FStationDesign>(Design, JsonString))
-		{
-			UE_LOG(LogTemp, Error, TEXT("Failed to serialize station design to JSON"));
-			return false;
-		}
+		UE_LOG(LogTemp, Error, TEXT("Failed to save station file: %s"), *FilePath);
+		return false;
 	}
 	
-	// Save to file
-	if (!FFileHelper::SaveStringToFile(JsonString, *FilePath))
+	NotifyLibraryFileChanged(FilePath);
+	UE_LOG(LogTemp, Log, TEXT("Station saved successfully: %s"), *FilePath);
+	return true;
+}
+
+bool FStationFileHelper::SaveStationToBinaryFile(const FStationDesign& Design, const FString& FilePath)
+{
+	// Ensure directory exists
+	EnsureDirectoryExists(FPaths::GetPath(FilePath));
+	
+	if (!FStationBinaryFormat::Save(Design, FilePath))
 	{
-		UE_LOG(LogTemp, Error, TEXT("Failed to save station file: %s"), *FilePath);
 		return false;
 	}
 	
-	UE_LOG(LogTemp, Log, TEXT("Station saved successfully: %s"), *FilePath);
+	NotifyLibraryFileChanged(FilePath);
+	UE_LOG(LogTemp, Log, TEXT("Station saved successfully (binary): %s"), *FilePath);
 	return true;
 }
 
@@ -59,16 +50,21 @@ bool FStationFileHelper::LoadStationFromFile(const FString& FilePath, FStationDe
 		return false;
 	}
 	
-	// Load file contents
-	FString JsonString;
-	if (!FFileHelper::LoadFileToString(JsonString, *FilePath))
+	// Binary designs are read in place, no JSON involved
+	if (FStationBinaryFormat::IsBinaryFile(FilePath))
 	{
-		UE_LOG(LogTemp, Error, TEXT("Failed to load station file: %s"), *FilePath);
-		return false;
+		if (!FStationBinaryFormat::Load(FilePath, OutDesign))
+		{
+			UE_LOG(LogTemp, Error, TEXT("Failed to parse binary station file: %s"), *FilePath);
+			return false;
+		}
+		
+		UE_LOG(LogTemp, Log, TEXT("Station loaded successfully (binary): %s"), *FilePath);
+		return true;
 	}
 	
-	// Parse JSON
-	if (!FJsonObjectConverter::JsonObjectStringToUStruct(JsonString, &OutDesign, 0, 0))
+	// Parse JSON token by token
+	if (!FStationJsonStream::LoadFromFile(FilePath, OutDesign))
 	{
 		UE_LOG(LogTemp, Error, TEXT("Failed to parse station JSON: %s"), *FilePath);
 		return false;
@@ -87,21 +83,8 @@ FString FStationFileHelper::GetStationDesignsDirectory()
 
 TArray<FString> FStationFileHelper::GetAvailableStationFiles()
 {
-	TArray<FString> StationFiles;
-	FString Directory = GetStationDesignsDirectory();
-	
-	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
-	
-	// Find all .station files
-	PlatformFile.FindFiles(StationFiles, *Directory, TEXT(".station"));
-	
-	// Sort by modification time (newest first)
-	StationFiles.Sort([&PlatformFile](const FString& A, const FString& B)
-	{
-		return PlatformFile.GetTimeStamp(*A) > PlatformFile.GetTimeStamp(*B);
-	});
-	
-	return StationFiles;
+	// Served from the library index, sorted by modification time (newest first)
+	return FStationLibraryIndex::Get().GetFiles();
 }
 
 bool FStationFileHelper::IsValidStationFile(const FString& FilePath)
@@ -117,32 +100,59 @@ bool FStationFileHelper::IsValidStationFile(const FString& FilePath)
 		return false;
 	}
 	
-	// Try to parse the file
-	FStationDesign TestDesign;
-	FString JsonString;
-	if (!FFileHelper::LoadFileToString(JsonString, *FilePath))
+	FStationFileMetadata Metadata;
+	return ReadStationFileMetadata(FilePath, Metadata);
+}
+
+bool FStationFileHelper::ReadStationFileMetadata(const FString& FilePath, FStationFileMetadata& OutMetadata)
+{
+	// Header-only read of the leading metadata block
+	const bool bBinary = FStationBinaryFormat::IsBinaryFile(FilePath);
+	if (bBinary ? FStationBinaryFormat::ReadMetadata(FilePath, OutMetadata) : FStationJsonStream::ReadMetadataFromFile(FilePath, OutMetadata))
+	{
+		return true;
+	}
+	
+	// Legacy file without a metadata block
+	UE_LOG(LogTemp, Verbose, TEXT("No metadata block, parsing full station file: %s"), *FilePath);
+	FStationDesign Design;
+	const bool bLoaded = bBinary ? FStationBinaryFormat::Load(FilePath, Design) : FStationJsonStream::LoadFromFile(FilePath, Design);
+	if (!bLoaded)
 	{
 		return false;
 	}
 	
-	return FJsonObjectConverter::JsonObjectStringToUStruct(JsonString, &TestDesign, 0, 0);
+	OutMetadata = FStationFileMetadata::FromDesign(Design);
+	return true;
 }
 
 bool FStationFileHelper::GetStationFileInfo(const FString& FilePath, FString& OutName, int32& OutModuleCount, FDateTime& OutTimestamp)
 {
+	// Library designs are answered from the index without touching the file
+	if (FStationLibraryIndex::IsAvailable())
+	{
+		if (const FStationLibraryIndex::FEntry* Entry = FStationLibraryIndex::Get().FindEntry(FilePath))
+		{
+			OutName = Entry->Metadata.StationName;
+			OutModuleCount = Entry->Metadata.ModuleCount;
+			OutTimestamp = Entry->Timestamp;
+			return true;
+		}
+	}
+	
 	// Get file timestamp
 	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
 	OutTimestamp = PlatformFile.GetTimeStamp(*FilePath);
 	
-	// Load and parse file
-	FStationDesign Design;
-	if (!LoadStationFromFile(FilePath, Design))
+	// Read the metadata block only
+	FStationFileMetadata Metadata;
+	if (!ReadStationFileMetadata(FilePath, Metadata))
 	{
 		return false;
 	}
 	
-	OutName = Design.StationName;
-	OutModuleCount = Design.Modules.Num();
+	OutName = Metadata.StationName;
+	OutModuleCount = Metadata.ModuleCount;
 	
 	return true;
 }
@@ -165,6 +175,7 @@ FString FStationFileHelper::BackupStationFile(const FString& FilePath)
 	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
 	if (PlatformFile.CopyFile(*BackupPath, *FilePath))
 	{
+		NotifyLibraryFileChanged(BackupPath);
 		UE_LOG(LogTemp, Log, TEXT("Backup created: %s"), *BackupPath);
 		return BackupPath;
 	}
@@ -195,6 +206,7 @@ bool FStationFileHelper::DeleteStationFile(const FString& FilePath, bool bCreate
 	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
 	if (PlatformFile.DeleteFile(*FilePath))
 	{
+		NotifyLibraryFileChanged(FilePath);
 		UE_LOG(LogTemp, Log, TEXT("Station file deleted: %s"), *FilePath);
 		return true;
 	}
@@ -209,6 +221,10 @@ bool FStationFileHelper::ExportStationDesign(const FStationDesign& Design, const
 	{
 		return SaveStationToFile(Design, FilePath, true);
 	}
+	else if (Format.Equals(TEXT("binary"), ESearchCase::IgnoreCase))
+	{
+		return SaveStationToBinaryFile(Design, FilePath);
+	}
 	else if (Format.Equals(TEXT("csv"), ESearchCase::IgnoreCase))
 	{
 		// Export to CSV format (module list)
@@ -259,3 +275,12 @@ FString FStationFileHelper::GenerateUniqueFilename(const FString& Directory, con
 	
 	return Filename;
 }
+
+void FStationFileHelper::NotifyLibraryFileChanged(const FString& FilePath)
+{
+	// Directory notifications lag behind, so keep a live index current straight away
+	if (FStationLibraryIndex::IsAvailable())
+	{
+		FStationLibraryIndex::Get().UpdateFile(FilePath);
+	}
+}
@@ -0,0 +1,85 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "StationFileMetadata.h"
+#include "Hash/xxhash.h"
+#include "Misc/Parse.h"
+
+namespace
+{
+	void HashString(FXxHash64Builder& Builder, const FString& String)
+	{
+		// Length first so adjacent strings can't run together
+		const int32 Length = String.Len();
+		Builder.Update(&Length, sizeof(Length));
+		Builder.Update(*String, Length * sizeof(TCHAR));
+	}
+}
+
+FStationFileMetadata FStationFileMetadata::FromDesign(const FStationDesign& Design)
+{
+	FStationFileMetadata Metadata;
+	Metadata.StationName = Design.StationName;
+	Metadata.DesignVersion = Design.DesignVersion;
+	Metadata.ModuleCount = Design.Modules.Num();
+	Metadata.ContentHash = ComputeContentHash(Design);
+	return Metadata;
+}
+
+uint64 FStationFileMetadata::ComputeContentHash(const FStationDesign& Design)
+{
+	FXxHash64Builder Builder;
+	HashString(Builder, Design.StationName);
+	HashString(Builder, Design.DesignVersion);
+
+	for (const FModulePlacement& Module : Design.Modules)
+	{
+		HashString(Builder, Module.ModuleID);
+		HashString(Builder, Module.ModuleBlueprintPath.ToString());
+		HashString(Builder, Module.ComponentName);
+
+		const FQuat Rotation = Module.Transform.GetRotation();
+		const FVector Translation = Module.Transform.GetTranslation();
+		const FVector Scale = Module.Transform.GetScale3D();
+		// Float precision, as stored by the binary format, so the hash survives a round trip through either format
+		const float Components[10] = {
+			float(Rotation.X), float(Rotation.Y), float(Rotation.Z), float(Rotation.W),
+			float(Translation.X), float(Translation.Y), float(Translation.Z),
+			float(Scale.X), float(Scale.Y), float(Scale.Z) };
+		Builder.Update(Components, sizeof(Components));
+
+		const int32 NumConnections = Module.ConnectedModuleIDs.Num();
+		Builder.Update(&NumConnections, sizeof(NumConnections));
+		for (const FString& ConnectedID : Module.ConnectedModuleIDs)
+		{
+			HashString(Builder, ConnectedID);
+		}
+	}
+
+	return Builder.Finalize().Hash;
+}
+
+FString FStationFileMetadata::GetContentHashString() const
+{
+	return FString::Printf(TEXT("%016llx"), ContentHash);
+}
+
+bool FStationFileMetadata::SetContentHashFromString(const FString& HashString)
+{
+	if (HashString.Len() != 16)
+	{
+		return false;
+	}
+
+	uint64 Value = 0;
+	for (const TCHAR Char : HashString)
+	{
+		if (!FChar::IsHexDigit(Char))
+		{
+			return false;
+		}
+		Value = (Value << 4) | FParse::HexDigit(Char);
+	}
+
+	ContentHash = Value;
+	return true;
+}
@@ -0,0 +1,458 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "StationJsonStream.h"
+#include "StationFileMetadata.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Policies/PrettyJsonPrintPolicy.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonWriter.h"
+
+namespace
+{
+	/** Keys as FJsonObjectConverter::StandardizeCase writes the UPROPERTY names */
+	const TCHAR* const MetadataKey = TEXT("metadata");
+	const TCHAR* const ModuleCountKey = TEXT("moduleCount");
+	const TCHAR* const ContentHashKey = TEXT("contentHash");
+	const TCHAR* const StationNameKey = TEXT("stationName");
+	const TCHAR* const ModulesKey = TEXT("modules");
+	const TCHAR* const DesignVersionKey = TEXT("designVersion");
+	const TCHAR* const ModuleIDKey = TEXT("moduleId");
+	const TCHAR* const BlueprintPathKey = TEXT("moduleBlueprintPath");
+	const TCHAR* const TransformKey = TEXT("transform");
+	const TCHAR* const ComponentNameKey = TEXT("componentName");
+	const TCHAR* const ConnectedModuleIDsKey = TEXT("connectedModuleIds");
+	const TCHAR* const RotationKey = TEXT("rotation");
+	const TCHAR* const TranslationKey = TEXT("translation");
+	const TCHAR* const Scale3DKey = TEXT("scale3D");
+
+	/** Rough size of one compact module entry, presizes the module array for files without metadata */
+	constexpr int64 EstimatedBytesPerModule = 300;
+
+	/** Bytes read from the start of a file to find its metadata object */
+	constexpr int64 MaxMetadataBytes = 4096;
+
+	bool KeyEquals(const FString& Identifier, const TCHAR* Key)
+	{
+		return Identifier.Equals(Key, ESearchCase::IgnoreCase);
+	}
+
+	template <class CharType, class PrintPolicy>
+	void WriteVector(TJsonWriter<CharType, PrintPolicy>& Writer, const TCHAR* Key, const FVector& Vector)
+	{
+		Writer.WriteObjectStart(Key);
+		Writer.WriteValue(TEXT("x"), Vector.X);
+		Writer.WriteValue(TEXT("y"), Vector.Y);
+		Writer.WriteValue(TEXT("z"), Vector.Z);
+		Writer.WriteObjectEnd();
+	}
+
+	template <class PrintPolicy>
+	void WriteDesign(const FStationDesign& Design, FArchive& Archive)
+	{
+		TSharedRef<TJsonWriter<UTF8CHAR, PrintPolicy>> Writer = TJsonWriterFactory<UTF8CHAR, PrintPolicy>::Create(&Archive);
+
+		const FStationFileMetadata Metadata = FStationFileMetadata::FromDesign(Design);
+
+		Writer->WriteObjectStart();
+		Writer->WriteObjectStart(MetadataKey);
+		Writer->WriteValue(StationNameKey, Metadata.StationName);
+		Writer->WriteValue(ModuleCountKey, Metadata.ModuleCount);
+		Writer->WriteValue(DesignVersionKey, Metadata.DesignVersion);
+		Writer->WriteValue(ContentHashKey, Metadata.GetContentHashString());
+		Writer->WriteObjectEnd();
+		Writer->WriteValue(StationNameKey, Design.StationName);
+		Writer->WriteArrayStart(ModulesKey);
+		for (const FModulePlacement& Module : Design.Modules)
+		{
+			Writer->WriteObjectStart();
+			Writer->WriteValue(ModuleIDKey, Module.ModuleID);
+			Writer->WriteValue(BlueprintPathKey, Module.ModuleBlueprintPath.ToString());
+
+			const FQuat Rotation = Module.Transform.GetRotation();
+			Writer->WriteObjectStart(TransformKey);
+			Writer->WriteObjectStart(RotationKey);
+			Writer->WriteValue(TEXT("x"), Rotation.X);
+			Writer->WriteValue(TEXT("y"), Rotation.Y);
+			Writer->WriteValue(TEXT("z"), Rotation.Z);
+			Writer->WriteValue(TEXT("w"), Rotation.W);
+			Writer->WriteObjectEnd();
+			WriteVector(*Writer, TranslationKey, Module.Transform.GetTranslation());
+			WriteVector(*Writer, Scale3DKey, Module.Transform.GetScale3D());
+			Writer->WriteObjectEnd();
+
+			Writer->WriteValue(ComponentNameKey, Module.ComponentName);
+			Writer->WriteArrayStart(ConnectedModuleIDsKey);
+			for (const FString& ConnectedID : Module.ConnectedModuleIDs)
+			{
+				Writer->WriteValue(ConnectedID);
+			}
+			Writer->WriteArrayEnd();
+			Writer->WriteObjectEnd();
+		}
+		Writer->WriteArrayEnd();
+		Writer->WriteValue(DesignVersionKey, Design.DesignVersion);
+		Writer->WriteObjectEnd();
+		Writer->Close();
+	}
+
+	/** Skip the value that follows an identifier */
+	template <class CharType>
+	bool SkipValue(TJsonReader<CharType>& Reader, EJsonNotation Notation)
+	{
+		if (Notation == EJsonNotation::ObjectStart)
+		{
+			return Reader.SkipObject();
+		}
+		if (Notation == EJsonNotation::ArrayStart)
+		{
+			return Reader.SkipArray();
+		}
+		return Notation != EJsonNotation::Error;
+	}
+
+	/** Read the metadata object's fields after its ObjectStart */
+	template <class CharType>
+	bool ReadMetadataObject(TJsonReader<CharType>& Reader, FStationFileMetadata& OutMetadata)
+	{
+		bool bHasHash = false;
+		EJsonNotation Notation;
+		while (Reader.ReadNext(Notation) && Notation != EJsonNotation::ObjectEnd)
+		{
+			const FString& Identifier = Reader.GetIdentifier();
+			if (Notation == EJsonNotation::String && KeyEquals(Identifier, StationNameKey))
+			{
+				OutMetadata.StationName = Reader.GetValueAsString();
+			}
+			else if (Notation == EJsonNotation::String && KeyEquals(Identifier, DesignVersionKey))
+			{
+				OutMetadata.DesignVersion = Reader.GetValueAsString();
+			}
+			else if (Notation == EJsonNotation::Number && KeyEquals(Identifier, ModuleCountKey))
+			{
+				OutMetadata.ModuleCount = FMath::Max(0, int32(Reader.GetValueAsNumber()));
+			}
+			else if (Notation == EJsonNotation::String && KeyEquals(Identifier, ContentHashKey))
+			{
+				bHasHash = OutMetadata.SetContentHashFromString(Reader.GetValueAsString());
+			}
+			else if (!SkipValue(Reader, Notation))
+			{
+				return false;
+			}
+		}
+		return Notation == EJsonNotation::ObjectEnd && bHasHash;
+	}
+
+	/** Read the fields of an object of numbers (x/y/z/w) after its ObjectStart */
+	template <class CharType>
+	bool ReadComponents(TJsonReader<CharType>& Reader, double& X, double& Y, double& Z, double* W)
+	{
+		EJsonNotation Notation;
+		while (Reader.ReadNext(Notation) && Notation != EJsonNotation::ObjectEnd)
+		{
+			const FString& Identifier = Reader.GetIdentifier();
+			if (Notation == EJsonNotation::Number)
+			{
+				const double Value = Reader.GetValueAsNumber();
+				if (KeyEquals(Identifier, TEXT("x"))) { X = Value; }
+				else if (KeyEquals(Identifier, TEXT("y"))) { Y = Value; }
+				else if (KeyEquals(Identifier, TEXT("z"))) { Z = Value; }
+				else if (W && KeyEquals(Identifier, TEXT("w"))) { *W = Value; }
+			}
+			else if (!SkipValue(Reader, Notation))
+			{
+				return false;
+			}
+		}
+		return Notation == EJsonNotation::ObjectEnd;
+	}
+
+	template <class CharType>
+	bool ReadTransform(TJsonReader<CharType>& Reader, FTransform& OutTransform)
+	{
+		FQuat Rotation = FQuat::Identity;
+		FVector Translation = FVector::ZeroVector;
+		FVector Scale = FVector::OneVector;
+
+		EJsonNotation Notation;
+		while (Reader.ReadNext(Notation) && Notation != EJsonNotation::ObjectEnd)
+		{
+			const FString& Identifier = Reader.GetIdentifier();
+			bool bOk = true;
+			if (Notation == EJsonNotation::ObjectStart && KeyEquals(Identifier, RotationKey))
+			{
+				bOk = ReadComponents(Reader, Rotation.X, Rotation.Y, Rotation.Z, &Rotation.W);
+			}
+			else if (Notation == EJsonNotation::ObjectStart && KeyEquals(Identifier, TranslationKey))
+			{
+				bOk = ReadComponents(Reader, Translation.X, Translation.Y, Translation.Z, nullptr);
+			}
+			else if (Notation == EJsonNotation::ObjectStart && KeyEquals(Identifier, Scale3DKey))
+			{
+				bOk = ReadComponents(Reader, Scale.X, Scale.Y, Scale.Z, nullptr);
+			}
+			else
+			{
+				bOk = SkipValue(Reader, Notation);
+			}
+
+			if (!bOk)
+			{
+				return false;
+			}
+		}
+
+		OutTransform = FTransform(Rotation, Translation, Scale);
+		return Notation == EJsonNotation::ObjectEnd;
+	}
+
+	template <class CharType>
+	bool ReadModule(TJsonReader<CharType>& Reader, FModulePlacement& OutModule)
+	{
+		EJsonNotation Notation;
+		while (Reader.ReadNext(Notation) && Notation != EJsonNotation::ObjectEnd)
+		{
+			const FString& Identifier = Reader.GetIdentifier();
+			bool bOk = true;
+			if (Notation == EJsonNotation::String)
+			{
+				if (KeyEquals(Identifier, ModuleIDKey))
+				{
+					OutModule.ModuleID = Reader.GetValueAsString();
+				}
+				else if (KeyEquals(Identifier, BlueprintPathKey))
+				{
+					OutModule.ModuleBlueprintPath = FSoftClassPath(Reader.GetValueAsString());
+				}
+				else if (KeyEquals(Identifier, ComponentNameKey))
+				{
+					OutModule.ComponentName = Reader.GetValueAsString();
+				}
+				else if (KeyEquals(Identifier, TransformKey))
+				{
+					// Text form, as written by ExportText
+					OutModule.Transform.InitFromString(Reader.GetValueAsString());
+				}
+			}
+			else if (Notation == EJsonNotation::ObjectStart && KeyEquals(Identifier, TransformKey))
+			{
+				bOk = ReadTransform(Reader, OutModule.Transform);
+			}
+			else if (Notation == EJsonNotation::ArrayStart && KeyEquals(Identifier, ConnectedModuleIDsKey))
+			{
+				while (Reader.ReadNext(Notation) && Notation == EJsonNotation::String)
+				{
+					OutModule.ConnectedModuleIDs.Add(Reader.GetValueAsString());
+				}
+				bOk = Notation == EJsonNotation::ArrayEnd;
+			}
+			else
+			{
+				bOk = SkipValue(Reader, Notation);
+			}
+
+			if (!bOk)
+			{
+				return false;
+			}
+		}
+		return Notation == EJsonNotation::ObjectEnd;
+	}
+}
+
+bool FStationJsonStream::Write(const FStationDesign& Design, FArchive& Archive, bool bPrettyPrint)
+{
+	if (bPrettyPrint)
+	{
+		WriteDesign<TPrettyJsonPrintPolicy<UTF8CHAR>>(Design, Archive);
+	}
+	else
+	{
+		WriteDesign<TCondensedJsonPrintPolicy<UTF8CHAR>>(Design, Archive);
+	}
+	return !Archive.IsError();
+}
+
+template <class CharType>
+bool FStationJsonStream::Read(TJsonReader<CharType>& Reader, FStationDesign& OutDesign, int32 ExpectedModuleCount)
+{
+	OutDesign.Modules.Reset(ExpectedModuleCount);
+
+	EJsonNotation Notation;
+	if (!Reader.ReadNext(Notation) || Notation != EJsonNotation::ObjectStart)
+	{
+		return false;
+	}
+
+	while (Reader.ReadNext(Notation) && Notation != EJsonNotation::ObjectEnd)
+	{
+		const FString& Identifier = Reader.GetIdentifier();
+		bool bOk = true;
+		if (Notation == EJsonNotation::String && KeyEquals(Identifier, StationNameKey))
+		{
+			OutDesign.StationName = Reader.GetValueAsString();
+		}
+		else if (Notation == EJsonNotation::String && KeyEquals(Identifier, DesignVersionKey))
+		{
+			OutDesign.DesignVersion = Reader.GetValueAsString();
+		}
+		else if (Notation == EJsonNotation::ObjectStart && KeyEquals(Identifier, MetadataKey))
+		{
+			// Leading summary, gives the exact module count to reserve
+			FStationFileMetadata Metadata;
+			if (ReadMetadataObject(Reader, Metadata))
+			{
+				OutDesign.Modules.Reserve(Metadata.ModuleCount);
+			}
+		}
+		else if (Notation == EJsonNotation::ArrayStart && KeyEquals(Identifier, ModulesKey))
+		{
+			while (Reader.ReadNext(Notation) && Notation == EJsonNotation::ObjectStart)
+			{
+				if (!ReadModule(Reader, OutDesign.Modules.AddDefaulted_GetRef()))
+				{
+					bOk = false;
+					break;
+				}
+			}
+			bOk = bOk && Notation == EJsonNotation::ArrayEnd;
+		}
+		else
+		{
+			bOk = SkipValue(Reader, Notation);
+		}
+
+		if (!bOk)
+		{
+			break;
+		}
+	}
+
+	if (Notation != EJsonNotation::ObjectEnd)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to parse station JSON: %s"), *Reader.GetErrorMessage());
+		return false;
+	}
+
+	OutDesign.MarkModified();
+	return true;
+}
+
+template bool FStationJsonStream::Read<TCHAR>(TJsonReader<TCHAR>&, FStationDesign&, int32);
+template bool FStationJsonStream::Read<UTF8CHAR>(TJsonReader<UTF8CHAR>&, FStationDesign&, int32);
+
+bool FStationJsonStream::ReadMetadataFromFile(const FString& FilePath, FStationFileMetadata& OutMetadata)
+{
+	TUniquePtr<FArchive> FileReader(IFileManager::Get().CreateFileReader(*FilePath));
+	if (!FileReader.IsValid())
+	{
+		return false;
+	}
+
+	// The metadata object is written first, so the head of the file is enough
+	TArray<uint8> HeadData;
+	HeadData.SetNumUninitialized(int32(FMath::Min(FileReader->TotalSize(), MaxMetadataBytes)));
+	FileReader->Serialize(HeadData.GetData(), HeadData.Num());
+	if (!FileReader->Close())
+	{
+		return false;
+	}
+
+	const auto ReadLeadingMetadata = [&OutMetadata](auto& Reader)
+	{
+		EJsonNotation Notation;
+		if (!Reader.ReadNext(Notation) || Notation != EJsonNotation::ObjectStart)
+		{
+			return false;
+		}
+
+		// A value cut off by the end of the buffer reads as an error, so files without metadata fail here
+		while (Reader.ReadNext(Notation) && Notation != EJsonNotation::ObjectEnd)
+		{
+			if (Notation == EJsonNotation::ObjectStart && KeyEquals(Reader.GetIdentifier(), MetadataKey))
+			{
+				return ReadMetadataObject(Reader, OutMetadata);
+			}
+			if (!SkipValue(Reader, Notation))
+			{
+				return false;
+			}
+		}
+		return false;
+	};
+
+	if (HeadData.Num() >= 2 && ((HeadData[0] == 0xFF && HeadData[1] == 0xFE) || (HeadData[0] == 0xFE && HeadData[1] == 0xFF)))
+	{
+		// UTF-16, keep whole code units only
+		FString JsonString;
+		FFileHelper::BufferToString(JsonString, HeadData.GetData(), HeadData.Num() & ~1);
+
+		TSharedRef<TJsonReader<TCHAR>> Reader = TJsonReaderFactory<TCHAR>::Create(MoveTemp(JsonString));
+		return ReadLeadingMetadata(*Reader);
+	}
+
+	int32 Start = 0;
+	if (HeadData.Num() >= 3 && HeadData[0] == 0xEF && HeadData[1] == 0xBB && HeadData[2] == 0xBF)
+	{
+		Start = 3; // UTF-8 byte order mark
+	}
+
+	const FUtf8StringView JsonView(reinterpret_cast<const UTF8CHAR*>(HeadData.GetData()) + Start, HeadData.Num() - Start);
+	TSharedRef<TJsonReader<UTF8CHAR>> Reader = TJsonReaderFactory<UTF8CHAR>::CreateFromView(JsonView);
+	return ReadLeadingMetadata(*Reader);
+}
+
+bool FStationJsonStream::SaveToFile(const FStationDesign& Design, const FString& FilePath, bool bPrettyPrint)
+{
+	TUniquePtr<FArchive> FileWriter(IFileManager::Get().CreateFileWriter(*FilePath));
+	if (!FileWriter.IsValid())
+	{
+		return false;
+	}
+
+	const bool bWritten = Write(Design, *FileWriter, bPrettyPrint);
+	return FileWriter->Close() && bWritten;
+}
+
+bool FStationJsonStream::LoadFromFile(const FString& FilePath, FStationDesign& OutDesign)
+{
+	TArray<uint8> FileData;
+	if (!FFileHelper::LoadFileToArray(FileData, *FilePath))
+	{
+		return false;
+	}
+
+	const int32 ExpectedModuleCount = int32(FileData.Num() / EstimatedBytesPerModule);
+	bool bParsed = false;
+
+	if (FileData.Num() >= 2 && ((FileData[0] == 0xFF && FileData[1] == 0xFE) || (FileData[0] == 0xFE && FileData[1] == 0xFF)))
+	{
+		// UTF-16 written by FFileHelper::SaveStringToFile for non-ANSI text
+		FString JsonString;
+		FFileHelper::BufferToString(JsonString, FileData.GetData(), FileData.Num());
+		FileData.Empty();
+
+		TSharedRef<TJsonReader<TCHAR>> Reader = TJsonReaderFactory<TCHAR>::Create(MoveTemp(JsonString));
+		bParsed = Read(*Reader, OutDesign, ExpectedModuleCount);
+	}
+	else
+	{
+		int32 Start = 0;
+		if (FileData.Num() >= 3 && FileData[0] == 0xEF && FileData[1] == 0xBB && FileData[2] == 0xBF)
+		{
+			Start = 3; // UTF-8 byte order mark
+		}
+
+		const FUtf8StringView JsonView(reinterpret_cast<const UTF8CHAR*>(FileData.GetData()) + Start, FileData.Num() - Start);
+		TSharedRef<TJsonReader<UTF8CHAR>> Reader = TJsonReaderFactory<UTF8CHAR>::CreateFromView(JsonView);
+		bParsed = Read(*Reader, OutDesign, ExpectedModuleCount);
+	}
+
+	if (bParsed)
+	{
+		OutDesign.RebuildModuleIndex();
+	}
+	return bParsed;
+}
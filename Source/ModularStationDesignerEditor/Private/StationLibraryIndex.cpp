@@ -0,0 +1,341 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "StationLibraryIndex.h"
+#include "StationFileHelper.h"
+#include "DirectoryWatcherModule.h"
+#include "IDirectoryWatcher.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Modules/ModuleManager.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace
+{
+	/** Bump when the entry layout changes to discard old indexes */
+	constexpr int32 StationLibraryIndexVersion = 1;
+
+	const TCHAR* StationFileExtension = TEXT(".station");
+}
+
+TUniquePtr<FStationLibraryIndex> FStationLibraryIndex::Instance;
+
+FStationLibraryIndex& FStationLibraryIndex::Get()
+{
+	if (!Instance.IsValid())
+	{
+		Instance = TUniquePtr<FStationLibraryIndex>(new FStationLibraryIndex());
+	}
+	return *Instance;
+}
+
+void FStationLibraryIndex::Shutdown()
+{
+	Instance.Reset();
+}
+
+bool FStationLibraryIndex::IsAvailable()
+{
+	return Instance.IsValid();
+}
+
+FStationLibraryIndex::FStationLibraryIndex()
+	: bDirty(false)
+{
+	Directory = FPaths::ConvertRelativePathToFull(FStationFileHelper::GetStationDesignsDirectory());
+	FPaths::NormalizeDirectoryName(Directory);
+
+	LoadIndex();
+
+	// Catch up with edits made while the editor was closed
+	Refresh();
+
+	// Notifications arrive on the game thread while the editor ticks
+	FDirectoryWatcherModule& DirectoryWatcherModule = FModuleManager::LoadModuleChecked<FDirectoryWatcherModule>(TEXT("DirectoryWatcher"));
+	if (IDirectoryWatcher* DirectoryWatcher = DirectoryWatcherModule.Get())
+	{
+		DirectoryWatcher->RegisterDirectoryChangedCallback_Handle(
+			Directory,
+			IDirectoryWatcher::FDirectoryChanged::CreateRaw(this, &FStationLibraryIndex::HandleDirectoryChanged),
+			DirectoryWatcherHandle,
+			IDirectoryWatcher::WatchOptions::IgnoreChangesInSubtree);
+	}
+}
+
+FStationLibraryIndex::~FStationLibraryIndex()
+{
+	if (DirectoryWatcherHandle.IsValid())
+	{
+		if (FDirectoryWatcherModule* DirectoryWatcherModule = FModuleManager::GetModulePtr<FDirectoryWatcherModule>(TEXT("DirectoryWatcher")))
+		{
+			if (IDirectoryWatcher* DirectoryWatcher = DirectoryWatcherModule->Get())
+			{
+				DirectoryWatcher->UnregisterDirectoryChangedCallback_Handle(Directory, DirectoryWatcherHandle);
+			}
+		}
+	}
+
+	SaveIndexIfDirty();
+}
+
+TArray<FString> FStationLibraryIndex::GetFiles() const
+{
+	TArray<const FEntry*> SortedEntries;
+	SortedEntries.Reserve(Entries.Num());
+	for (const auto& Pair : Entries)
+	{
+		SortedEntries.Add(&Pair.Value);
+	}
+
+	// Newest first
+	SortedEntries.Sort([](const FEntry& A, const FEntry& B)
+	{
+		return A.Timestamp > B.Timestamp;
+	});
+
+	TArray<FString> Files;
+	Files.Reserve(SortedEntries.Num());
+	for (const FEntry* Entry : SortedEntries)
+	{
+		Files.Add(Entry->FilePath);
+	}
+	return Files;
+}
+
+const FStationLibraryIndex::FEntry* FStationLibraryIndex::FindEntry(const FString& FilePath) const
+{
+	FString FullPath = FPaths::ConvertRelativePathToFull(FilePath);
+	FPaths::NormalizeFilename(FullPath);
+	if (!IsLibraryFile(FullPath))
+	{
+		return nullptr;
+	}
+
+	return Entries.Find(FPaths::GetCleanFilename(FullPath));
+}
+
+void FStationLibraryIndex::UpdateFile(const FString& FilePath)
+{
+	ApplyFileChange(FilePath);
+	SaveIndexIfDirty();
+}
+
+void FStationLibraryIndex::ApplyFileChange(const FString& FilePath)
+{
+	FString FullPath = FPaths::ConvertRelativePathToFull(FilePath);
+	FPaths::NormalizeFilename(FullPath);
+	if (!IsLibraryFile(FullPath))
+	{
+		return;
+	}
+
+	const FFileStatData StatData = FPlatformFileManager::Get().GetPlatformFile().GetStatData(*FullPath);
+	if (!StatData.bIsValid || StatData.bIsDirectory || !IndexFile(FullPath, StatData.ModificationTime, StatData.FileSize))
+	{
+		if (Entries.Remove(FPaths::GetCleanFilename(FullPath)) > 0)
+		{
+			bDirty = true;
+		}
+	}
+}
+
+void FStationLibraryIndex::Refresh()
+{
+	TSet<FString> SeenFiles;
+	SeenFiles.Reserve(Entries.Num());
+
+	// One directory pass returns the stat data, so unchanged files cost no extra I/O
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	PlatformFile.IterateDirectoryStat(*Directory, [this, &SeenFiles](const TCHAR* FilenameOrDirectory, const FFileStatData& StatData)
+	{
+		FString FilePath(FilenameOrDirectory);
+		if (StatData.bIsDirectory || !FilePath.EndsWith(StationFileExtension))
+		{
+			return true;
+		}
+
+		FPaths::NormalizeFilename(FilePath);
+		if (IndexFile(FilePath, StatData.ModificationTime, StatData.FileSize))
+		{
+			SeenFiles.Add(FPaths::GetCleanFilename(FilePath));
+		}
+		return true;
+	});
+
+	for (auto It = Entries.CreateIterator(); It; ++It)
+	{
+		if (!SeenFiles.Contains(It.Key()))
+		{
+			It.RemoveCurrent();
+			bDirty = true;
+		}
+	}
+
+	SaveIndexIfDirty();
+}
+
+FString FStationLibraryIndex::GetIndexFilePath() const
+{
+	return Directory / TEXT("StationLibrary.index");
+}
+
+bool FStationLibraryIndex::IsLibraryFile(const FString& FilePath) const
+{
+	return FilePath.EndsWith(StationFileExtension) && FPaths::GetPath(FilePath).Equals(Directory, ESearchCase::IgnoreCase);
+}
+
+bool FStationLibraryIndex::IndexFile(const FString& FilePath, const FDateTime& Timestamp, int64 FileSize)
+{
+	const FString Filename = FPaths::GetCleanFilename(FilePath);
+
+	FEntry* Existing = Entries.Find(Filename);
+	if (Existing && Existing->Timestamp == Timestamp && Existing->FileSize == FileSize)
+	{
+		return true;
+	}
+
+	FStationFileMetadata Metadata;
+	if (!FStationFileHelper::ReadStationFileMetadata(FilePath, Metadata))
+	{
+		return false;
+	}
+
+	FEntry& Entry = Existing ? *Existing : Entries.Add(Filename);
+	Entry.FilePath = FilePath;
+	Entry.Timestamp = Timestamp;
+	Entry.FileSize = FileSize;
+	Entry.Metadata = MoveTemp(Metadata);
+	bDirty = true;
+	return true;
+}
+
+void FStationLibraryIndex::HandleDirectoryChanged(const TArray<FFileChangeData>& Changes)
+{
+	TSet<FString> ChangedFiles;
+	for (const FFileChangeData& Change : Changes)
+	{
+		if (Change.Filename.EndsWith(StationFileExtension))
+		{
+			ChangedFiles.Add(Change.Filename);
+		}
+	}
+
+	// Added, modified and removed all resolve the same way: stat the file and re-index or drop it
+	for (const FString& FilePath : ChangedFiles)
+	{
+		ApplyFileChange(FilePath);
+	}
+
+	// One index write per notification batch
+	SaveIndexIfDirty();
+}
+
+void FStationLibraryIndex::LoadIndex()
+{
+	Entries.Reset();
+
+	FString JsonString;
+	if (!FFileHelper::LoadFileToString(JsonString, *GetIndexFilePath()))
+	{
+		return; // First run
+	}
+
+	TSharedPtr<FJsonObject> Root;
+	const TSharedRef<TJsonReader<TCHAR>> Reader = TJsonReaderFactory<TCHAR>::Create(JsonString);
+	if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Ignoring unreadable station library index: %s"), *GetIndexFilePath());
+		return;
+	}
+
+	if (Root->GetIntegerField(TEXT("version")) != StationLibraryIndexVersion)
+	{
+		return;
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* FileValues = nullptr;
+	if (!Root->TryGetArrayField(TEXT("files"), FileValues))
+	{
+		return;
+	}
+
+	Entries.Reserve(FileValues->Num());
+	for (const TSharedPtr<FJsonValue>& Value : *FileValues)
+	{
+		const TSharedPtr<FJsonObject>* FileObject = nullptr;
+		if (!Value.IsValid() || !Value->TryGetObject(FileObject))
+		{
+			continue;
+		}
+
+		FString Filename;
+		FString TimestampString;
+		FString HashString;
+		FEntry Entry;
+		int64 Ticks = 0;
+		if (!(*FileObject)->TryGetStringField(TEXT("file"), Filename) ||
+			!(*FileObject)->TryGetStringField(TEXT("timestamp"), TimestampString) ||
+			!(*FileObject)->TryGetNumberField(TEXT("size"), Entry.FileSize) ||
+			!(*FileObject)->TryGetStringField(TEXT("contentHash"), HashString) ||
+			!LexTryParseString(Ticks, *TimestampString) ||
+			!Entry.Metadata.SetContentHashFromString(HashString))
+		{
+			continue;
+		}
+
+		// Ticks exceed a double's integer range, so they are stored as a string
+		Entry.FilePath = Directory / Filename;
+		Entry.Timestamp = FDateTime(Ticks);
+		Entry.Metadata.StationName = (*FileObject)->GetStringField(TEXT("stationName"));
+		Entry.Metadata.DesignVersion = (*FileObject)->GetStringField(TEXT("designVersion"));
+		Entry.Metadata.ModuleCount = (*FileObject)->GetIntegerField(TEXT("moduleCount"));
+
+		Entries.Add(Filename, MoveTemp(Entry));
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("Loaded station library index with %d designs"), Entries.Num());
+}
+
+void FStationLibraryIndex::SaveIndexIfDirty()
+{
+	if (!bDirty)
+	{
+		return;
+	}
+
+	FString JsonString;
+	const TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+		TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&JsonString);
+
+	Writer->WriteObjectStart();
+	Writer->WriteValue(TEXT("version"), StationLibraryIndexVersion);
+	Writer->WriteArrayStart(TEXT("files"));
+	for (const auto& Pair : Entries)
+	{
+		const FEntry& Entry = Pair.Value;
+
+		Writer->WriteObjectStart();
+		Writer->WriteValue(TEXT("file"), Pair.Key);
+		Writer->WriteValue(TEXT("timestamp"), LexToString(Entry.Timestamp.GetTicks()));
+		Writer->WriteValue(TEXT("size"), Entry.FileSize);
+		Writer->WriteValue(TEXT("stationName"), Entry.Metadata.StationName);
+		Writer->WriteValue(TEXT("designVersion"), Entry.Metadata.DesignVersion);
+		Writer->WriteValue(TEXT("moduleCount"), Entry.Metadata.ModuleCount);
+		Writer->WriteValue(TEXT("contentHash"), Entry.Metadata.GetContentHashString());
+		Writer->WriteObjectEnd();
+	}
+	Writer->WriteArrayEnd();
+	Writer->WriteObjectEnd();
+	Writer->Close();
+
+	if (!FFileHelper::SaveStringToFile(JsonString, *GetIndexFilePath()))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Failed to write station library index: %s"), *GetIndexFilePath());
+		return;
+	}
+
+	bDirty = false;
+}
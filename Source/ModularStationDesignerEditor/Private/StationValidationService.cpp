@@ -0,0 +1,95 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "StationValidationService.h"
+#include "StationConnectivityTracker.h"
+#include "Async/Async.h"
+#include "Async/TaskGraphInterfaces.h"
+
+FStationValidationService::FStationValidationService()
+	: LatestGeneration(MakeShared<TAtomic<uint32>, ESPMode::ThreadSafe>(0))
+	, bPendingKnownFullyConnected(false)
+	, bRunInFlight(false)
+{
+}
+
+void FStationValidationService::RequestValidation(const FStationDesign& Design, FStationConnectivityTracker* ConnectivityTracker)
+{
+	check(IsInGameThread());
+
+	// The tracker belongs to the game thread, so read its answer before handing off
+	bool bKnownFullyConnected = false;
+	if (ConnectivityTracker)
+	{
+		ConnectivityTracker->Refresh(Design);
+		bKnownFullyConnected = ConnectivityTracker->GetNumComponents() <= 1;
+	}
+
+	const uint32 RunGeneration = ++(*LatestGeneration);
+	TSharedRef<const FStationDesign> Snapshot = MakeShared<FStationDesign>(Design);
+
+	if (bRunInFlight)
+	{
+		// The in-flight run is now stale; validate this snapshot as soon as it returns
+		PendingSnapshot = Snapshot;
+		bPendingKnownFullyConnected = bKnownFullyConnected;
+		return;
+	}
+
+	LaunchRun(Snapshot, bKnownFullyConnected, RunGeneration);
+}
+
+void FStationValidationService::Cancel()
+{
+	check(IsInGameThread());
+
+	++(*LatestGeneration);
+	PendingSnapshot.Reset();
+}
+
+void FStationValidationService::LaunchRun(TSharedRef<const FStationDesign> Snapshot, bool bKnownFullyConnected, uint32 RunGeneration)
+{
+	bRunInFlight = true;
+
+	TWeakPtr<FStationValidationService> WeakService = AsShared();
+	TSharedRef<TAtomic<uint32>, ESPMode::ThreadSafe> Generation = LatestGeneration;
+
+	FFunctionGraphTask::CreateAndDispatchWhenReady([WeakService, Generation, Snapshot, bKnownFullyConnected, RunGeneration]()
+	{
+		TArray<FValidationMessage> Messages;
+
+		// Skip the work entirely if a newer edit arrived while this run was queued
+		if (Generation->Load() == RunGeneration)
+		{
+			Messages = FStationValidator::ValidateStation(*Snapshot, bKnownFullyConnected);
+		}
+
+		AsyncTask(ENamedThreads::GameThread, [WeakService, RunGeneration, Messages = MoveTemp(Messages)]() mutable
+		{
+			if (TSharedPtr<FStationValidationService> Service = WeakService.Pin())
+			{
+				Service->HandleRunComplete(RunGeneration, MoveTemp(Messages));
+			}
+		});
+	}, TStatId(), nullptr, ENamedThreads::AnyBackgroundThreadNormalTask);
+}
+
+void FStationValidationService::HandleRunComplete(uint32 RunGeneration, TArray<FValidationMessage>&& Messages)
+{
+	bRunInFlight = false;
+
+	if (PendingSnapshot.IsValid())
+	{
+		TSharedRef<const FStationDesign> Snapshot = PendingSnapshot.ToSharedRef();
+		PendingSnapshot.Reset();
+		LaunchRun(Snapshot, bPendingKnownFullyConnected, LatestGeneration->Load());
+		return;
+	}
+
+	if (RunGeneration != LatestGeneration->Load())
+	{
+		return; // Cancelled
+	}
+
+	UE_LOG(LogTemp, Verbose, TEXT("Background validation finished with %d messages"), Messages.Num());
+	ValidationCompleteDelegate.ExecuteIfBound(Messages);
+}
@@ -1,14 +1,15 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "StationValidator.h"
+#include "StationModuleGraph.h"
 
-TArray<FValidationMessage> FStationValidator::ValidateStation(const FStationDesign& Design)
+TArray<FValidationMessage> FStationValidator::ValidateStation(const FStationDesign& Design, bool bKnownFullyConnected)
 {
 	TArray<FValidationMessage> Messages;
 
 	// Run all validation checks
 	CheckRequiredModules(Design, Messages);
-	CheckConnectivity(Design, Messages);
+	CheckConnectivity(Design, bKnownFullyConnected, Messages);
 	CheckPowerBalance(Design, Messages);
 	CheckModuleCompatibility(Design, Messages);
 
@@ -80,63 +81,34 @@ void FStationValidator::CheckRequiredModules(const FStationDesign& Design, TArra
 	}
 }
 
-void FStationValidator::CheckConnectivity(const FStationDesign& Design, TArray<FValidationMessage>& OutMessages)
+void FStationValidator::CheckConnectivity(const FStationDesign& Design, bool bKnownFullyConnected, TArray<FValidationMessage>& OutMessages)
 {
 	if (Design.Modules.Num() <= 1)
 	{
 		return; // Single module or empty station doesn't need connectivity check
 	}
 
-	// Build connectivity graph using module connections
-	TMap<FString, TSet<FString>> ConnectivityGraph;
-	for (const FModulePlacement& Module : Design.Modules)
+	// A connectivity tracker already proved there are no orphans, skip the graph walk
+	if (!bKnownFullyConnected)
 	{
-		if (!ConnectivityGraph.Contains(Module.ModuleID))
-		{
-			ConnectivityGraph.Add(Module.ModuleID, TSet<FString>());
-		}
-		
-		for (const FString& ConnectedID : Module.ConnectedModuleIDs)
-		{
-			ConnectivityGraph[Module.ModuleID].Add(ConnectedID);
-		}
-	}
+		// Integer handles cached on the design for this revision; the walk only touches ints
+		const FStationModuleGraph& Graph = Design.GetModuleGraph();
 
-	// Perform BFS to check if all modules are reachable from the first module
-	if (Design.Modules.Num() > 0)
-	{
-		TSet<FString> Visited;
-		TArray<FString> Queue;
-		
-		// Start from first module
-		const FString& StartModuleID = Design.Modules[0].ModuleID;
-		Queue.Add(StartModuleID);
-		Visited.Add(StartModuleID);
-		
-		// BFS traversal - use index instead of RemoveAt for O(n) complexity
-		int32 QueueIndex = 0;
-		while (QueueIndex < Queue.Num())
+		// Connections are physical links, so follow them in either direction from the first module
+		TBitArray<> Connected;
+		const int32 NumConnected = Graph.FindConnected(0, Connected);
+
+		// Check for orphaned modules
+		if (NumConnected < Graph.NumModules())
 		{
-			const FString& CurrentID = Queue[QueueIndex++];
-			
-			if (ConnectivityGraph.Contains(CurrentID))
+			for (int32 Handle = 0; Handle < Graph.NumModules(); ++Handle)
 			{
-				for (const FString& NeighborID : ConnectivityGraph[CurrentID])
+				if (Connected[Handle])
 				{
-					if (!Visited.Contains(NeighborID))
-					{
-						Visited.Add(NeighborID);
-						Queue.Add(NeighborID);
-					}
+					continue;
 				}
-			}
-		}
-		
-		// Check for orphaned modules
-		for (const FModulePlacement& Module : Design.Modules)
-		{
-			if (!Visited.Contains(Module.ModuleID))
-			{
+
+				const FModulePlacement& Module = Design.Modules[Handle];
 				OutMessages.Add(FValidationMessage(
 					EValidationSeverity::Error,
 					FString::Printf(TEXT("Module '%s' (ID: %s) is not connected to the main station. All modules must be connected."), 
@@ -145,19 +117,19 @@ void FStationValidator::CheckConnectivity(const FStationDesign& Design, TArray<F
 				));
 			}
 		}
-		
-		// Additional check for modules with no connections in multi-module stations
-		for (const FModulePlacement& Module : Design.Modules)
+	}
+	
+	// Additional check for modules with no connections in multi-module stations
+	for (const FModulePlacement& Module : Design.Modules)
+	{
+		if (Module.ConnectedModuleIDs.Num() == 0)
 		{
-			if (Module.ConnectedModuleIDs.Num() == 0 && Design.Modules.Num() > 1)
-			{
-				OutMessages.Add(FValidationMessage(
-					EValidationSeverity::Warning,
-					FString::Printf(TEXT("Module '%s' has no connections. It should be connected to at least one other module."), 
-						*Module.ComponentName),
-					Module.ModuleID
-				));
-			}
+			OutMessages.Add(FValidationMessage(
+				EValidationSeverity::Warning,
+				FString::Printf(TEXT("Module '%s' has no connections. It should be connected to at least one other module."), 
+					*Module.ComponentName),
+				Module.ModuleID
+			));
 		}
 	}
 }
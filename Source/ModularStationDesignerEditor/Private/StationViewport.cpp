@@ -2,6 +2,7 @@
 
 #include "StationViewport.h"
 #include "StationViewportClient.h"
+#include "StationCommandManager.h"
 #include "ModuleDragDropOp.h"
 #include "PreviewScene.h"
 #include "SceneView.h"
@@ -13,6 +14,7 @@ static constexpr float ScreenToWorldScale = 10.0f;
 
 SStationViewport::SStationViewport()
 	: ExternalDesign(nullptr)
+	, CommandManager(nullptr)
 	, SelectedModuleIndex(INDEX_NONE)
 {
 }
@@ -25,11 +27,13 @@ void SStationViewport::Construct(const FArguments& InArgs)
 {
 	// Store pointer to external design if provided
 	ExternalDesign = InArgs._StationDesign;
+	CommandManager = InArgs._CommandManager;
 	
 	// Initialize internal design (used as fallback)
 	InternalDesign = FStationDesign();
 	
 	SelectedModuleIndex = INDEX_NONE;
+	OnDesignChanged = InArgs._OnDesignChanged;
 
 	// Create preview scene for rendering
 	PreviewScene = MakeShared<FPreviewScene>(FPreviewScene::ConstructionValues());
@@ -63,10 +67,18 @@ void SStationViewport::AddModule(const FModuleInfo& ModuleInfo, const FTransform
 	NewPlacement.Transform = Transform;
 	NewPlacement.ComponentName = ModuleInfo.Name;
 
-	GetActiveDesign().Modules.Add(NewPlacement);
+	if (CommandManager)
+	{
+		CommandManager->ExecuteCommand(MakeShared<FAddModuleCommand>(NewPlacement), GetActiveDesign());
+	}
+	else
+	{
+		GetActiveDesign().AddModule(NewPlacement);
+	}
 
 	// Refresh the viewport to show the new module
 	RefreshViewport();
+	OnDesignChanged.ExecuteIfBound();
 
 	UE_LOG(LogTemp, Log, TEXT("Added module: %s at location %s"),
 		*ModuleInfo.Name, *Transform.GetLocation().ToString());
@@ -76,18 +88,34 @@ void SStationViewport::RemoveSelectedModule()
 {
 	if (SelectedModuleIndex >= 0 && SelectedModuleIndex < GetActiveDesign().Modules.Num())
 	{
-		GetActiveDesign().Modules.RemoveAt(SelectedModuleIndex);
+		if (CommandManager)
+		{
+			const FString ModuleID = GetActiveDesign().Modules[SelectedModuleIndex].ModuleID;
+			CommandManager->ExecuteCommand(MakeShared<FRemoveModuleCommand>(ModuleID), GetActiveDesign());
+		}
+		else
+		{
+			GetActiveDesign().RemoveModuleAt(SelectedModuleIndex);
+		}
 		SelectedModuleIndex = INDEX_NONE;
 		RefreshViewport();
+		OnDesignChanged.ExecuteIfBound();
 		UE_LOG(LogTemp, Log, TEXT("Removed selected module"));
 	}
 }
 
 void SStationViewport::ClearModules()
 {
-	GetActiveDesign().Modules.Empty();
+	GetActiveDesign().EmptyModules();
+	if (CommandManager)
+	{
+		// Not undoable; earlier commands no longer apply to the emptied design
+		CommandManager->ClearHistory();
+		CommandManager->GetConnectivityTracker().Invalidate();
+	}
 	SelectedModuleIndex = INDEX_NONE;
 	RefreshViewport();
+	OnDesignChanged.ExecuteIfBound();
 	UE_LOG(LogTemp, Log, TEXT("Cleared all modules"));
 }
 
@@ -101,6 +129,11 @@ void SStationViewport::SetCurrentDesign(const FStationDesign& Design)
 	{
 		InternalDesign = Design;
 	}
+	if (CommandManager)
+	{
+		CommandManager->ClearHistory();
+		CommandManager->GetConnectivityTracker().Invalidate();
+	}
 	SelectedModuleIndex = INDEX_NONE;
 	RefreshViewport();
 }
@@ -10,16 +10,46 @@
 #include "Engine/Canvas.h"
 #include "SceneManagement.h"
 #include "Components/StaticMeshComponent.h"
+#include "Components/InstancedStaticMeshComponent.h"
 #include "Engine/StaticMesh.h"
 #include "Engine/Blueprint.h"
 #include "GameFramework/Actor.h"
+#include "Components/LineBatchComponent.h"
+#include "ModulePreviewMeshCache.h"
+
+namespace
+{
+	/** Smallest minor grid spacing (cm) */
+	constexpr float GridMinSpacing = 100.0f;
+
+	/** Every Nth minor line is drawn as a major line */
+	constexpr int32 GridMajorLineEvery = 10;
+
+	/** Upper bound on grid lines per axis, keeps the batch size flat when zoomed out */
+	constexpr float GridMaxLinesPerAxis = 200.0f;
+
+	/** How far (in camera heights) view rays above the horizon extend the grid */
+	constexpr float GridHorizonScale = 50.0f;
+
+	/** Below this projected size (fraction of half-screen width) modules draw as points */
+	constexpr float ModulePointScreenSize = 0.01f;
+
+	/** Below this projected size modules drop their orientation axes */
+	constexpr float ModuleAxesScreenSize = 0.05f;
+}
 
 FStationViewportClient::FStationViewportClient(FPreviewScene* InPreviewScene, const TWeakPtr<SEditorViewport>& InEditorViewportWidget)
 	: FEditorViewportClient(nullptr, InPreviewScene, InEditorViewportWidget)
 	, CurrentDesign(nullptr)
 	, PreviewScene(InPreviewScene)
+	, PreviewMeshCacheGeneration(FModulePreviewMeshCache::Get().GetGeneration())
 	, AnimationTime(0.0f)
-	, CachedGridLines(0)
+	, CachedModuleColorsRevision(0)
+	, GridLineBatch(nullptr)
+	, GridMinorSpacing(0.0f)
+	, GridRegion(ForceInit)
+	, GridViewFootprint(ForceInit)
+	, GridViewCameraHeight(0.0f)
 {
 	// Set up viewport for 3D visualization
 	SetViewMode(VMI_Lit);
@@ -36,16 +66,23 @@ FStationViewportClient::FStationViewportClient(FPreviewScene* InPreviewScene, co
 	EngineShowFlags.SetGrid(true);
 	EngineShowFlags.SetSnap(false);
 
-	// Pre-calculate grid lines (GridSize=10000, GridSpacing=100)
-	const float GridSize = 10000.0f;
-	const float GridSpacing = 100.0f;
-	CachedGridLines = FMath::CeilToInt(GridSize / GridSpacing);
+	// Reference grid lives in the scene as one line batch, filled from Tick
+	if (PreviewScene)
+	{
+		GridLineBatch = NewObject<ULineBatchComponent>(GetTransientPackage());
+		PreviewScene->AddComponent(GridLineBatch, FTransform::Identity);
+	}
 }
 
 FStationViewportClient::~FStationViewportClient()
 {
 	// Clean up all preview components
 	ClearPreviewComponents();
+
+	if (PreviewScene && GridLineBatch)
+	{
+		PreviewScene->RemoveComponent(GridLineBatch);
+	}
 }
 
 void FStationViewportClient::Tick(float DeltaSeconds)
@@ -54,6 +91,18 @@ void FStationViewportClient::Tick(float DeltaSeconds)
 	
 	// Update animation time for visual effects
 	AnimationTime += DeltaSeconds;
+
+	// A blueprint was recompiled or reloaded: previews may point at stale meshes
+	const uint32 MeshCacheGeneration = FModulePreviewMeshCache::Get().GetGeneration();
+	if (MeshCacheGeneration != PreviewMeshCacheGeneration)
+	{
+		PreviewMeshCacheGeneration = MeshCacheGeneration;
+		ClearPreviewComponents();
+		UpdatePreviewComponents();
+	}
+
+	// Scene primitives may only change here, never while the view is being drawn
+	UpdateGrid();
 }
 
 void FStationViewportClient::Draw(const FSceneView* View, FPrimitiveDrawInterface* PDI)
@@ -65,8 +114,8 @@ void FStationViewportClient::Draw(const FSceneView* View, FPrimitiveDrawInterfac
 		return;
 	}
 
-	// Draw visualization elements
-	DrawGrid(View, PDI);
+	// Draw visualization elements (the grid renders from its own line batch, rebuilt in Tick)
+	CacheGridView(View);
 	DrawModules(View, PDI);
 	DrawConnectionWires(View, PDI);
 	
@@ -110,6 +159,12 @@ void FStationViewportClient::DrawCanvas(FViewport& InViewport, FSceneView& View,
 
 void FStationViewportClient::SetStationDesign(FStationDesign* InDesign)
 {
+	if (InDesign != CurrentDesign)
+	{
+		// A different design replaces the old one: nothing it was waiting for is needed anymore
+		CancelPendingMeshLoads();
+	}
+	
 	CurrentDesign = InDesign;
 	
 	// Update preview components to match new design
@@ -123,50 +178,108 @@ void FStationViewportClient::DrawModules(const FSceneView* View, FPrimitiveDrawI
 		return;
 	}
 
+	UpdateModuleColors();
+
+	// Default module size (can be customized later based on module type)
+	const FVector BoxExtent(100.0f, 100.0f, 50.0f);
+	const float AxisLength = 75.0f;
+	const FVector CullExtent = BoxExtent.ComponentMax(FVector(AxisLength));
+	const float BoundsRadius = CullExtent.Size();
+
+	// Projected size of the module bounds as a fraction of the half-screen width
+	const FVector ViewOrigin = View->ViewMatrices.GetViewOrigin();
+	const bool bPerspective = View->IsPerspectiveProjection();
+	const float ProjectionScale = View->ViewMatrices.GetProjectionMatrix().M[0][0];
+
 	// Draw each module - either the loaded mesh (via preview components) or a wireframe fallback
-	for (const FModulePlacement& Module : CurrentDesign->Modules)
+	for (int32 Index = 0; Index < CurrentDesign->Modules.Num(); ++Index)
 	{
-		// Check if we have a preview component with a mesh for this module
-		UStaticMeshComponent* Component = PreviewComponents.FindRef(Module.ModuleID);
-		bool bHasMesh = Component && Component->GetStaticMesh();
+		const FModulePlacement& Module = CurrentDesign->Modules[Index];
+		const FVector Location = Module.Transform.GetLocation();
+
+		if (!View->ViewFrustum.IntersectBox(Location, CullExtent))
+		{
+			continue;
+		}
+
+		float ScreenSize = 1.0f;
+		if (bPerspective)
+		{
+			ScreenSize = BoundsRadius * ProjectionScale / FMath::Max(FVector::Dist(ViewOrigin, Location), 1.0f);
+		}
+
+		const FLinearColor& ModuleColor = CachedModuleColors[Index];
+
+		// Far away: a single point is all that stays readable
+		if (ScreenSize < ModulePointScreenSize)
+		{
+			PDI->DrawPoint(Location, ModuleColor, 4.0f, SDPG_World);
+			continue;
+		}
+
+		// Check if we have a preview instance with a mesh for this module
+		bool bHasMesh = PreviewInstances.Contains(Module.ModuleID);
 		
 		if (!bHasMesh)
 		{
-			// Draw wireframe fallback if mesh couldn't be loaded
-			FVector Location = Module.Transform.GetLocation();
-			
-			// Default module size (can be customized later based on module type)
-			FVector BoxExtent(100.0f, 100.0f, 50.0f);
-			
-			// Get color based on module name (simplified)
-			FLinearColor ModuleColor = FLinearColor::White;
-			FString ModuleName = Module.ModuleBlueprintPath.GetAssetName();
-			
-			if (ModuleName.Contains(TEXT("Docking")))
-			{
-				ModuleColor = FVisualizationSystem::GetColorForModuleGroup(EStationModuleGroup::Docking);
-			}
-			else if (ModuleName.Contains(TEXT("Power")) || ModuleName.Contains(TEXT("Reactor")))
-			{
-				ModuleColor = FVisualizationSystem::GetColorForModuleGroup(EStationModuleGroup::Power);
-			}
-			else if (ModuleName.Contains(TEXT("Storage")) || ModuleName.Contains(TEXT("Cargo")))
-			{
-				ModuleColor = FVisualizationSystem::GetColorForModuleGroup(EStationModuleGroup::Storage);
-			}
-			else if (ModuleName.Contains(TEXT("Habitat")))
-			{
-				ModuleColor = FVisualizationSystem::GetColorForModuleGroup(EStationModuleGroup::Habitation);
-			}
-			
-			// Draw the module as a wireframe box
+			// Draw the module as a wireframe box if the mesh couldn't be loaded
 			FBox Box(Location - BoxExtent, Location + BoxExtent);
 			DrawWireBox(PDI, Box, ModuleColor, SDPG_World);
 		}
 		
-		// Always draw orientation indicator
-		DrawModuleAxes(PDI, Module.Transform.GetLocation(), Module.Transform, 75.0f);
+		// Orientation indicator only when the module is large enough on screen to read it
+		if (ScreenSize >= ModuleAxesScreenSize)
+		{
+			DrawModuleAxes(PDI, Location, Module.Transform, AxisLength);
+		}
+	}
+}
+
+void FStationViewportClient::UpdateModuleColors()
+{
+	if (CachedModuleColorsRevision == CurrentDesign->GetRevision() && CachedModuleColors.Num() == CurrentDesign->Modules.Num())
+	{
+		return;
+	}
+
+	CachedModuleColors.Reset(CurrentDesign->Modules.Num());
+	for (const FModulePlacement& Module : CurrentDesign->Modules)
+	{
+		// Name matching runs once per blueprint, not once per module per frame
+		const FLinearColor* CachedColor = BlueprintColorCache.Find(Module.ModuleBlueprintPath);
+		if (!CachedColor)
+		{
+			CachedColor = &BlueprintColorCache.Add(Module.ModuleBlueprintPath, ClassifyModuleColor(Module.ModuleBlueprintPath));
+		}
+		CachedModuleColors.Add(*CachedColor);
+	}
+
+	CachedModuleColorsRevision = CurrentDesign->GetRevision();
+}
+
+FLinearColor FStationViewportClient::ClassifyModuleColor(const FSoftClassPath& BlueprintPath)
+{
+	// Get color based on module name (simplified)
+	const FString ModuleName = BlueprintPath.GetAssetName();
+	
+	if (ModuleName.Contains(TEXT("Docking")))
+	{
+		return FVisualizationSystem::GetColorForModuleGroup(EStationModuleGroup::Docking);
 	}
+	if (ModuleName.Contains(TEXT("Power")) || ModuleName.Contains(TEXT("Reactor")))
+	{
+		return FVisualizationSystem::GetColorForModuleGroup(EStationModuleGroup::Power);
+	}
+	if (ModuleName.Contains(TEXT("Storage")) || ModuleName.Contains(TEXT("Cargo")))
+	{
+		return FVisualizationSystem::GetColorForModuleGroup(EStationModuleGroup::Storage);
+	}
+	if (ModuleName.Contains(TEXT("Habitat")))
+	{
+		return FVisualizationSystem::GetColorForModuleGroup(EStationModuleGroup::Habitation);
+	}
+	
+	return FLinearColor::White;
 }
 
 void FStationViewportClient::DrawModuleAxes(FPrimitiveDrawInterface* PDI, const FVector& Location, const FTransform& Transform, float AxisLength)
@@ -190,7 +303,7 @@ void FStationViewportClient::DrawConnectionWires(const FSceneView* View, FPrimit
 	}
 
 	// Use visualization system to generate connection wires
-	TArray<FVisualizationSystem::FConnectionWire> Wires = FVisualizationSystem::GenerateConnectionWires(*CurrentDesign);
+	const TArray<FVisualizationSystem::FConnectionWire>& Wires = VisualizationCache.GetConnectionWires(*CurrentDesign);
 	
 	for (const auto& Wire : Wires)
 	{
@@ -209,7 +322,7 @@ void FStationViewportClient::DrawPowerFlow(const FSceneView* View, FPrimitiveDra
 	}
 
 	// Use visualization system to generate power flow lines
-	TArray<FVisualizationSystem::FPowerFlowVisualization> PowerFlows = FVisualizationSystem::GeneratePowerFlowLines(*CurrentDesign);
+	const TArray<FVisualizationSystem::FPowerFlowVisualization>& PowerFlows = VisualizationCache.GetPowerFlowLines(*CurrentDesign);
 	
 	for (const auto& Flow : PowerFlows)
 	{
@@ -228,40 +341,144 @@ void FStationViewportClient::DrawPowerFlow(const FSceneView* View, FPrimitiveDra
 	}
 }
 
-void FStationViewportClient::DrawGrid(const FSceneView* View, FPrimitiveDrawInterface* PDI)
+void FStationViewportClient::CacheGridView(const FSceneView* View)
 {
-	// Draw a simple reference grid at Z=0
-	const float GridSize = 10000.0f;
-	const float GridSpacing = 100.0f;
-	const FLinearColor GridColor = FLinearColor(0.3f, 0.3f, 0.3f, 0.5f);
-	
-	// Use cached grid lines value (computed once in constructor)
-	int32 NumLines = CachedGridLines;
-	
-	for (int32 i = -NumLines; i <= NumLines; ++i)
+	if (!View)
 	{
-		float Offset = i * GridSpacing;
-		
-		// Lines along X axis
-		PDI->DrawLine(
-			FVector(Offset, -GridSize, 0),
-			FVector(Offset, GridSize, 0),
-			GridColor,
-			SDPG_World
-		);
-		
-		// Lines along Y axis
-		PDI->DrawLine(
-			FVector(-GridSize, Offset, 0),
-			FVector(GridSize, Offset, 0),
-			GridColor,
-			SDPG_World
-		);
+		return;
 	}
-	
-	// Draw thicker center lines
-	PDI->DrawLine(FVector(-GridSize, 0, 0), FVector(GridSize, 0, 0), FLinearColor::Green, SDPG_World, 2.0f);
-	PDI->DrawLine(FVector(0, -GridSize, 0), FVector(0, GridSize, 0), FLinearColor::Red, SDPG_World, 2.0f);
+
+	const FVector ViewOrigin = View->ViewMatrices.GetViewOrigin();
+	const float CameraHeight = FMath::Max(FMath::Abs(ViewOrigin.Z), GridMinSpacing);
+
+	// Footprint of the view frustum on the grid plane; rays above the horizon are clamped
+	const float MaxRayDistance = CameraHeight * GridHorizonScale;
+	const FIntRect& ViewRect = View->UnscaledViewRect;
+	const FVector2D Corners[4] =
+	{
+		FVector2D(0.0f, 0.0f),
+		FVector2D(ViewRect.Width(), 0.0f),
+		FVector2D(0.0f, ViewRect.Height()),
+		FVector2D(ViewRect.Width(), ViewRect.Height())
+	};
+
+	FBox2D Footprint(ForceInit);
+	Footprint += FVector2D(ViewOrigin.X, ViewOrigin.Y);
+	for (const FVector2D& Corner : Corners)
+	{
+		FVector RayOrigin, RayDirection;
+		View->DeprojectFVector2D(Corner, RayOrigin, RayDirection);
+
+		float Distance = MaxRayDistance;
+		if (!FMath::IsNearlyZero(RayDirection.Z))
+		{
+			const float HitDistance = -RayOrigin.Z / RayDirection.Z;
+			if (HitDistance > 0.0f)
+			{
+				Distance = FMath::Min(HitDistance, MaxRayDistance);
+			}
+		}
+
+		const FVector Point = RayOrigin + RayDirection * Distance;
+		Footprint += FVector2D(Point.X, Point.Y);
+	}
+
+	GridViewFootprint = Footprint;
+	GridViewCameraHeight = CameraHeight;
+}
+
+void FStationViewportClient::UpdateGrid()
+{
+	if (!GridLineBatch)
+	{
+		return;
+	}
+
+	// The grid is only shown while a design is loaded
+	if (!CurrentDesign)
+	{
+		if (GridMinorSpacing > 0.0f)
+		{
+			GridLineBatch->Flush();
+			GridMinorSpacing = 0.0f;
+			GridRegion = FBox2D(ForceInit);
+		}
+		GridViewFootprint = FBox2D(ForceInit);
+		return;
+	}
+
+	if (!GridViewFootprint.bIsValid)
+	{
+		return; // No view drawn yet
+	}
+
+	// Minor spacing steps by powers of ten with camera height above the Z=0 plane
+	float MinorSpacing = FMath::Max(GridMinSpacing, FMath::Pow(10.0f, FMath::FloorToFloat(FMath::LogX(10.0f, GridViewCameraHeight))) / 10.0f);
+
+	// Coarsen until the footprint fits the line budget, so cost is flat at any zoom
+	const FBox2D& Footprint = GridViewFootprint;
+	const FVector2D FootprintSize = Footprint.GetSize();
+	while (FMath::Max(FootprintSize.X, FootprintSize.Y) / MinorSpacing > GridMaxLinesPerAxis)
+	{
+		MinorSpacing *= 10.0f;
+	}
+
+	// Snap the region outwards to major lines so small camera moves reuse the same batch
+	const float MajorSpacing = MinorSpacing * GridMajorLineEvery;
+	const FBox2D Region(
+		FVector2D(FMath::FloorToFloat(Footprint.Min.X / MajorSpacing) * MajorSpacing, FMath::FloorToFloat(Footprint.Min.Y / MajorSpacing) * MajorSpacing),
+		FVector2D(FMath::CeilToFloat(Footprint.Max.X / MajorSpacing) * MajorSpacing, FMath::CeilToFloat(Footprint.Max.Y / MajorSpacing) * MajorSpacing));
+
+	if (MinorSpacing == GridMinorSpacing && Region.Min == GridRegion.Min && Region.Max == GridRegion.Max)
+	{
+		return;
+	}
+
+	RebuildGrid(MinorSpacing, Region);
+}
+
+void FStationViewportClient::RebuildGrid(float MinorSpacing, const FBox2D& Region)
+{
+	GridMinorSpacing = MinorSpacing;
+	GridRegion = Region;
+
+	const FLinearColor MinorColor(0.3f, 0.3f, 0.3f, 0.5f);
+	const FLinearColor MajorColor(0.5f, 0.5f, 0.5f, 0.8f);
+
+	const int32 MinX = FMath::RoundToInt(Region.Min.X / MinorSpacing);
+	const int32 MaxX = FMath::RoundToInt(Region.Max.X / MinorSpacing);
+	const int32 MinY = FMath::RoundToInt(Region.Min.Y / MinorSpacing);
+	const int32 MaxY = FMath::RoundToInt(Region.Max.Y / MinorSpacing);
+
+	TArray<FBatchedLine> Lines;
+	Lines.Reserve((MaxX - MinX + 1) + (MaxY - MinY + 1) + 2);
+
+	for (int32 i = MinX; i <= MaxX; ++i)
+	{
+		const float X = i * MinorSpacing;
+		const bool bMajor = (i % GridMajorLineEvery) == 0;
+		Lines.Emplace(FVector(X, Region.Min.Y, 0.0f), FVector(X, Region.Max.Y, 0.0f), bMajor ? MajorColor : MinorColor, 0.0f, bMajor ? 1.0f : 0.0f, SDPG_World);
+	}
+
+	for (int32 i = MinY; i <= MaxY; ++i)
+	{
+		const float Y = i * MinorSpacing;
+		const bool bMajor = (i % GridMajorLineEvery) == 0;
+		Lines.Emplace(FVector(Region.Min.X, Y, 0.0f), FVector(Region.Max.X, Y, 0.0f), bMajor ? MajorColor : MinorColor, 0.0f, bMajor ? 1.0f : 0.0f, SDPG_World);
+	}
+
+	// Thicker world axes when they are in view
+	if (Region.Min.Y <= 0.0f && Region.Max.Y >= 0.0f)
+	{
+		Lines.Emplace(FVector(Region.Min.X, 0.0f, 0.0f), FVector(Region.Max.X, 0.0f, 0.0f), FLinearColor::Green, 0.0f, 2.0f, SDPG_World);
+	}
+	if (Region.Min.X <= 0.0f && Region.Max.X >= 0.0f)
+	{
+		Lines.Emplace(FVector(0.0f, Region.Min.Y, 0.0f), FVector(0.0f, Region.Max.Y, 0.0f), FLinearColor::Red, 0.0f, 2.0f, SDPG_World);
+	}
+
+	GridLineBatch->Flush();
+	GridLineBatch->DrawLines(Lines);
 }
 
 void FStationViewportClient::UpdatePreviewComponents()
@@ -274,14 +491,15 @@ void FStationViewportClient::UpdatePreviewComponents()
 
 	// Track which modules exist in the current design
 	TSet<FString> CurrentModuleIDs;
+	CurrentModuleIDs.Reserve(CurrentDesign->Modules.Num());
 	for (const FModulePlacement& Module : CurrentDesign->Modules)
 	{
 		CurrentModuleIDs.Add(Module.ModuleID);
 	}
 
-	// Remove components for modules that no longer exist
+	// Remove instances for modules that no longer exist
 	TArray<FString> ModulesToRemove;
-	for (const auto& Pair : PreviewComponents)
+	for (const auto& Pair : PreviewInstances)
 	{
 		if (!CurrentModuleIDs.Contains(Pair.Key))
 		{
@@ -291,144 +509,278 @@ void FStationViewportClient::UpdatePreviewComponents()
 
 	for (const FString& ModuleID : ModulesToRemove)
 	{
-		if (UStaticMeshComponent* Component = PreviewComponents[ModuleID])
+		RemovePreviewInstance(ModuleID);
+		ModuleBlueprintPaths.Remove(ModuleID);
+	}
+
+	// Stop waiting on meshes for modules that were removed
+	ModulesToRemove.Reset();
+	for (const auto& Pair : ModulesAwaitingMesh)
+	{
+		if (!CurrentModuleIDs.Contains(Pair.Key))
 		{
-			PreviewScene->RemoveComponent(Component);
+			ModulesToRemove.Add(Pair.Key);
 		}
-		PreviewComponents.Remove(ModuleID);
-		ModuleBlueprintPaths.Remove(ModuleID);
 	}
 
-	// Add or update components for current modules
+	for (const FString& ModuleID : ModulesToRemove)
+	{
+		StopAwaitingMesh(ModuleID);
+	}
+
+	// Add or update instances for current modules
 	for (const FModulePlacement& Module : CurrentDesign->Modules)
 	{
-		UStaticMeshComponent* Component = PreviewComponents.FindRef(Module.ModuleID);
+		const FPreviewInstanceRef* InstanceRef = PreviewInstances.Find(Module.ModuleID);
 		
-		if (!Component)
+		if (InstanceRef)
 		{
-			// Create new component for this module with proper Outer for garbage collection
-			// Using GetTransientPackage() allows components to be GC'd when no longer referenced
-			// Cleanup is ensured by ClearPreviewComponents() in destructor and SetStationDesign()
-			Component = NewObject<UStaticMeshComponent>(GetTransientPackage());
-			
-			if (Component)
+			const FSoftClassPath* CachedPath = ModuleBlueprintPaths.Find(Module.ModuleID);
+			if (CachedPath && *CachedPath == Module.ModuleBlueprintPath)
 			{
-				// Try to load the blueprint and extract the static mesh
-				// Note: Synchronous loading is used for simplicity in this initial implementation
-				// For production use with many modules, consider async loading with callbacks
-				TArray<UMaterialInterface*> Materials;
-				UStaticMesh* Mesh = LoadMeshFromBlueprintPath(Module.ModuleBlueprintPath, Materials);
-				
-				if (Mesh)
-				{
-					Component->SetStaticMesh(Mesh);
-					
-					// Copy materials
-					for (int32 i = 0; i < Materials.Num(); ++i)
-					{
-						Component->SetMaterial(i, Materials[i]);
-					}
-				}
-				
-				// Only add the component to the preview scene if it has a valid static mesh
-				if (Component->GetStaticMesh())
-				{
-					PreviewScene->AddComponent(Component, Module.Transform);
-					PreviewComponents.Add(Module.ModuleID, Component);
-					ModuleBlueprintPaths.Add(Module.ModuleID, Module.ModuleBlueprintPath);
-				}
+				// Same mesh: only the transform may have changed; render state is refreshed once per group below
+				PreviewGroups[InstanceRef->GroupIndex].Component->UpdateInstanceTransform(
+					InstanceRef->InstanceIndex, Module.Transform, /*bWorldSpace*/ true, /*bMarkRenderStateDirty*/ false, /*bTeleport*/ true);
+				continue;
 			}
+
+			// Blueprint path has changed: the module may belong to a different group now
+			RemovePreviewInstance(Module.ModuleID);
+			ModuleBlueprintPaths.Remove(Module.ModuleID);
 		}
-		else
+		else if (const FSoftClassPath* AwaitedPath = ModulesAwaitingMesh.Find(Module.ModuleID))
 		{
-			// Update existing component. If blueprint path changed, reload the mesh.
-			FSoftClassPath* CachedPath = ModuleBlueprintPaths.Find(Module.ModuleID);
-			bool bPathChanged = !CachedPath || *CachedPath != Module.ModuleBlueprintPath;
-			
-			if (bPathChanged)
+			if (*AwaitedPath == Module.ModuleBlueprintPath)
 			{
-				// Blueprint path has changed, reload the mesh
-				TArray<UMaterialInterface*> Materials;
-				UStaticMesh* NewMesh = LoadMeshFromBlueprintPath(Module.ModuleBlueprintPath, Materials);
-				
-				if (NewMesh && Component->GetStaticMesh() != NewMesh)
-				{
-					Component->SetStaticMesh(NewMesh);
-					
-					// Update materials as well
-					for (int32 i = 0; i < Materials.Num(); ++i)
-					{
-						Component->SetMaterial(i, Materials[i]);
-					}
-				}
-				
-				// Update the cached path (always, even if mesh load failed)
-				ModuleBlueprintPaths.FindOrAdd(Module.ModuleID) = Module.ModuleBlueprintPath;
+				continue; // Still streaming, the wireframe is drawn meanwhile
 			}
 			
-			// Always update the transform to match the module's placement.
-			Component->SetWorldTransform(Module.Transform);
+			StopAwaitingMesh(Module.ModuleID);
 		}
+
+		RequestPreviewMesh(Module);
+	}
+
+	// Cancel loads nobody is waiting for anymore (modules removed or switched blueprint)
+	CancelUnusedMeshLoads();
+
+	for (const FPreviewInstanceGroup& Group : PreviewGroups)
+	{
+		Group.Component->MarkRenderStateDirty();
 	}
 }
 
-void FStationViewportClient::ClearPreviewComponents()
+void FStationViewportClient::RequestPreviewMesh(const FModulePlacement& Module)
 {
-	if (!PreviewScene)
+	const FSoftClassPath& BlueprintPath = Module.ModuleBlueprintPath;
+	if (BlueprintPath.IsNull() || FModulePreviewMeshCache::Get().IsKnownWithoutMesh(BlueprintPath))
+	{
+		return; // Drawn as a wireframe
+	}
+
+	// Class already in memory: resolving the mesh is cheap, no need to go async
+	if (BlueprintPath.ResolveClass())
+	{
+		TArray<UMaterialInterface*> Materials;
+		if (UStaticMesh* Mesh = LoadMeshFromBlueprintPath(BlueprintPath, Materials))
+		{
+			AddPreviewInstance(Module, Mesh, Materials);
+			ModuleBlueprintPaths.Add(Module.ModuleID, BlueprintPath);
+		}
+		return;
+	}
+
+	// Coalesce: every module using this blueprint waits on a single request
+	ModulesAwaitingMesh.Add(Module.ModuleID, BlueprintPath);
+	FPendingMeshLoad& PendingLoad = PendingMeshLoads.FindOrAdd(BlueprintPath);
+	PendingLoad.WaitingModuleIDs.Add(Module.ModuleID);
+
+	if (PendingLoad.Handle.IsValid())
+	{
+		return;
+	}
+
+	TSharedPtr<FStreamableHandle> Handle = StreamableManager.RequestAsyncLoad(
+		BlueprintPath,
+		FStreamableDelegate::CreateRaw(this, &FStationViewportClient::OnPreviewMeshLoaded, BlueprintPath));
+
+	// The delegate may already have run (and removed the entry) if the load completed immediately
+	if (FPendingMeshLoad* StillPending = PendingMeshLoads.Find(BlueprintPath))
+	{
+		StillPending->Handle = Handle;
+	}
+}
+
+void FStationViewportClient::OnPreviewMeshLoaded(FSoftClassPath BlueprintPath)
+{
+	FPendingMeshLoad PendingLoad;
+	if (!PendingMeshLoads.RemoveAndCopyValue(BlueprintPath, PendingLoad))
+	{
+		return; // Cancelled
+	}
+
+	for (const FString& ModuleID : PendingLoad.WaitingModuleIDs)
+	{
+		ModulesAwaitingMesh.Remove(ModuleID);
+	}
+
+	if (!CurrentDesign || !PreviewScene)
+	{
+		return;
+	}
+
+	TArray<UMaterialInterface*> Materials;
+	UStaticMesh* Mesh = LoadMeshFromBlueprintPath(BlueprintPath, Materials);
+	if (!Mesh)
 	{
 		return;
 	}
 
-	// Remove all components from the preview scene
-	for (const auto& Pair : PreviewComponents)
+	for (const FString& ModuleID : PendingLoad.WaitingModuleIDs)
 	{
-		if (UStaticMeshComponent* Component = Pair.Value)
+		const FModulePlacement* Module = CurrentDesign->FindModule(ModuleID);
+		if (Module && Module->ModuleBlueprintPath == BlueprintPath && !PreviewInstances.Contains(ModuleID))
 		{
-			PreviewScene->RemoveComponent(Component);
+			AddPreviewInstance(*Module, Mesh, Materials);
+			ModuleBlueprintPaths.Add(ModuleID, BlueprintPath);
 		}
 	}
 
-	PreviewComponents.Empty();
-	ModuleBlueprintPaths.Empty();
+	// Swap the wireframes for the streamed meshes
+	Invalidate();
 }
 
-UStaticMesh* FStationViewportClient::LoadMeshFromBlueprintPath(const FSoftClassPath& BlueprintPath, TArray<UMaterialInterface*>& OutMaterials)
+void FStationViewportClient::StopAwaitingMesh(const FString& ModuleID)
 {
-	OutMaterials.Empty();
-	
-	if (BlueprintPath.IsNull())
+	FSoftClassPath BlueprintPath;
+	if (!ModulesAwaitingMesh.RemoveAndCopyValue(ModuleID, BlueprintPath))
 	{
-		return nullptr;
+		return;
 	}
-	
-	// Try to load the blueprint and extract the static mesh
-	UClass* BlueprintClass = BlueprintPath.TryLoadClass<UObject>();
-	if (!BlueprintClass)
+
+	if (FPendingMeshLoad* PendingLoad = PendingMeshLoads.Find(BlueprintPath))
 	{
-		return nullptr;
+		PendingLoad->WaitingModuleIDs.RemoveSwap(ModuleID);
 	}
-	
-	// Get the Class Default Object (CDO) to inspect components
-	AActor* DefaultActor = Cast<AActor>(BlueprintClass->GetDefaultObject());
-	if (!DefaultActor)
+}
+
+void FStationViewportClient::CancelUnusedMeshLoads()
+{
+	for (auto It = PendingMeshLoads.CreateIterator(); It; ++It)
 	{
-		return nullptr;
+		if (It.Value().WaitingModuleIDs.Num() == 0)
+		{
+			if (It.Value().Handle.IsValid())
+			{
+				It.Value().Handle->CancelHandle();
+			}
+			It.RemoveCurrent();
+		}
 	}
-	
-	// Try to find a static mesh component in the blueprint
-	TArray<UStaticMeshComponent*> MeshComponents;
-	DefaultActor->GetComponents<UStaticMeshComponent>(MeshComponents);
-	
-	if (MeshComponents.Num() > 0 && MeshComponents[0]->GetStaticMesh())
+}
+
+void FStationViewportClient::CancelPendingMeshLoads()
+{
+	// Move the map out first: cancelling must not call back into a half-cleared state
+	TMap<FSoftClassPath, FPendingMeshLoad> LoadsToCancel = MoveTemp(PendingMeshLoads);
+	PendingMeshLoads.Reset();
+	ModulesAwaitingMesh.Reset();
+
+	for (auto& Pair : LoadsToCancel)
 	{
-		// Copy materials
-		for (int32 i = 0; i < MeshComponents[0]->GetNumMaterials(); ++i)
+		if (Pair.Value.Handle.IsValid())
 		{
-			OutMaterials.Add(MeshComponents[0]->GetMaterial(i));
+			Pair.Value.Handle->CancelHandle();
 		}
-		
-		return MeshComponents[0]->GetStaticMesh();
 	}
-	
-	return nullptr;
+}
+
+void FStationViewportClient::AddPreviewInstance(const FModulePlacement& Module, UStaticMesh* Mesh, const TArray<UMaterialInterface*>& Materials)
+{
+	FPreviewMeshKey Key;
+	Key.Mesh = Mesh;
+	Key.Materials = Materials;
+
+	int32 GroupIndex = PreviewGroupByKey.FindRef(Key, INDEX_NONE);
+	if (GroupIndex == INDEX_NONE)
+	{
+		// Create the shared component for this mesh/material set with proper Outer for garbage collection
+		// The preview scene keeps it referenced until ClearPreviewComponents() removes it
+		UInstancedStaticMeshComponent* Component = NewObject<UInstancedStaticMeshComponent>(GetTransientPackage());
+		Component->SetStaticMesh(Mesh);
+		for (int32 i = 0; i < Materials.Num(); ++i)
+		{
+			Component->SetMaterial(i, Materials[i]);
+		}
+
+		// Keep instance indices stable except for the one swapped into a removed slot
+		Component->SetRemoveSwap();
+
+		PreviewScene->AddComponent(Component, FTransform::Identity);
+
+		GroupIndex = PreviewGroups.AddDefaulted();
+		PreviewGroups[GroupIndex].Component = Component;
+		PreviewGroupByKey.Add(Key, GroupIndex);
+	}
+
+	FPreviewInstanceGroup& Group = PreviewGroups[GroupIndex];
+
+	FPreviewInstanceRef InstanceRef;
+	InstanceRef.GroupIndex = GroupIndex;
+	InstanceRef.InstanceIndex = Group.Component->AddInstance(Module.Transform, /*bWorldSpace*/ true);
+	check(InstanceRef.InstanceIndex == Group.InstanceModuleIDs.Num());
+
+	Group.InstanceModuleIDs.Add(Module.ModuleID);
+	PreviewInstances.Add(Module.ModuleID, InstanceRef);
+}
+
+void FStationViewportClient::RemovePreviewInstance(const FString& ModuleID)
+{
+	FPreviewInstanceRef InstanceRef;
+	if (!PreviewInstances.RemoveAndCopyValue(ModuleID, InstanceRef))
+	{
+		return;
+	}
+
+	FPreviewInstanceGroup& Group = PreviewGroups[InstanceRef.GroupIndex];
+	const int32 LastIndex = Group.InstanceModuleIDs.Num() - 1;
+
+	// The component swaps its last instance into the freed slot, mirror that in the mapping
+	Group.Component->RemoveInstance(InstanceRef.InstanceIndex);
+	Group.InstanceModuleIDs.RemoveAtSwap(InstanceRef.InstanceIndex);
+
+	if (InstanceRef.InstanceIndex != LastIndex)
+	{
+		PreviewInstances[Group.InstanceModuleIDs[InstanceRef.InstanceIndex]].InstanceIndex = InstanceRef.InstanceIndex;
+	}
+}
+
+void FStationViewportClient::ClearPreviewComponents()
+{
+	CancelPendingMeshLoads();
+
+	if (!PreviewScene)
+	{
+		return;
+	}
+
+	// Remove all instanced components from the preview scene
+	for (const FPreviewInstanceGroup& Group : PreviewGroups)
+	{
+		if (Group.Component)
+		{
+			PreviewScene->RemoveComponent(Group.Component);
+		}
+	}
+
+	PreviewGroups.Empty();
+	PreviewGroupByKey.Empty();
+	PreviewInstances.Empty();
+	ModuleBlueprintPaths.Empty();
+}
+
+UStaticMesh* FStationViewportClient::LoadMeshFromBlueprintPath(const FSoftClassPath& BlueprintPath, TArray<UMaterialInterface*>& OutMaterials)
+{
+	// Shared across viewports; only walks the blueprint CDO on a cache miss
+	return FModulePreviewMeshCache::Get().Resolve(BlueprintPath, OutMaterials);
 }
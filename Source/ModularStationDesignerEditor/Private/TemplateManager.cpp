@@ -72,7 +72,13 @@ bool FTemplateManager::LoadTemplate(const FString& TemplateName, FStationDesign&
 	FString JsonString;
 	if (FFileHelper::LoadFileToString(JsonString, *FilePath))
 	{
-		return FJsonObjectConverter::JsonObjectStringToUStruct(JsonString, &OutDesign, 0, 0);
+		if (!FJsonObjectConverter::JsonObjectStringToUStruct(JsonString, &OutDesign, 0, 0))
+		{
+			return false;
+		}
+		
+		OutDesign.RebuildModuleIndex();
+		return true;
 	}
 	
 	return false;
@@ -1,6 +1,7 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "VisualizationSystem.h"
+#include "StationModuleGraph.h"
 
 // Static member initialization
 TMap<EStationModuleGroup, FLinearColor> FVisualizationSystem::CustomColorScheme;
@@ -43,7 +44,7 @@ TArray<FVisualizationSystem::FPowerFlowVisualization> FVisualizationSystem::Gene
 		}
 	}
 	
-	UE_LOG(LogTemp, Log, TEXT("Generated %d power flow visualizations"), PowerFlows.Num());
+	UE_LOG(LogTemp, Verbose, TEXT("Generated %d power flow visualizations"), PowerFlows.Num());
 	return PowerFlows;
 }
 
@@ -81,31 +82,30 @@ TArray<FVisualizationSystem::FConnectionWire> FVisualizationSystem::GenerateConn
 {
 	TArray<FConnectionWire> Wires;
 	
-	// Generate wires based on connections
-	for (const FModulePlacement& Module : Design.Modules)
+	// Generate wires based on connections, walking integer handles instead of string IDs
+	const FStationModuleGraph& Graph = Design.GetModuleGraph();
+	Wires.Reserve(Graph.NumConnections());
+
+	for (int32 Handle = 0; Handle < Graph.NumModules(); ++Handle)
 	{
-		for (const FString& ConnectedID : Module.ConnectedModuleIDs)
+		const FModulePlacement& Module = Design.Modules[Handle];
+
+		for (const int32 ConnectedHandle : Graph.GetNeighbors(Handle))
 		{
-			// Find connected module
-			const FModulePlacement* ConnectedModule = Design.Modules.FindByPredicate(
-				[&ConnectedID](const FModulePlacement& M) { return M.ModuleID == ConnectedID; }
-			);
+			const FModulePlacement& ConnectedModule = Design.Modules[ConnectedHandle];
+
+			FConnectionWire Wire;
+			Wire.StartPoint = Module.Transform.GetLocation();
+			Wire.EndPoint = ConnectedModule.Transform.GetLocation();
+			Wire.ConnectionType = EConnectionType::Standard; // Simplified
+			Wire.Color = FLinearColor::Blue;
+			Wire.bIsValid = true;
 			
-			if (ConnectedModule)
-			{
-				FConnectionWire Wire;
-				Wire.StartPoint = Module.Transform.GetLocation();
-				Wire.EndPoint = ConnectedModule->Transform.GetLocation();
-				Wire.ConnectionType = EConnectionType::Standard; // Simplified
-				Wire.Color = FLinearColor::Blue;
-				Wire.bIsValid = true;
-				
-				Wires.Add(Wire);
-			}
+			Wires.Add(Wire);
 		}
 	}
 	
-	UE_LOG(LogTemp, Log, TEXT("Generated %d connection wires"), Wires.Num());
+	UE_LOG(LogTemp, Verbose, TEXT("Generated %d connection wires"), Wires.Num());
 	return Wires;
 }
 
@@ -149,10 +149,40 @@ TArray<FVisualizationSystem::FTrafficPath> FVisualizationSystem::GenerateTraffic
 		}
 	}
 	
-	UE_LOG(LogTemp, Log, TEXT("Generated %d traffic paths"), Paths.Num());
+	UE_LOG(LogTemp, Verbose, TEXT("Generated %d traffic paths"), Paths.Num());
 	return Paths;
 }
 
+const TArray<FVisualizationSystem::FConnectionWire>& FVisualizationCache::GetConnectionWires(const FStationDesign& Design)
+{
+	if (ConnectionWiresRevision != Design.GetRevision())
+	{
+		ConnectionWires = FVisualizationSystem::GenerateConnectionWires(Design);
+		ConnectionWiresRevision = Design.GetRevision();
+	}
+	
+	return ConnectionWires;
+}
+
+const TArray<FVisualizationSystem::FPowerFlowVisualization>& FVisualizationCache::GetPowerFlowLines(const FStationDesign& Design)
+{
+	if (PowerFlowLinesRevision != Design.GetRevision())
+	{
+		PowerFlowLines = FVisualizationSystem::GeneratePowerFlowLines(Design);
+		PowerFlowLinesRevision = Design.GetRevision();
+	}
+	
+	return PowerFlowLines;
+}
+
+void FVisualizationCache::Invalidate()
+{
+	ConnectionWires.Empty();
+	PowerFlowLines.Empty();
+	ConnectionWiresRevision = 0;
+	PowerFlowLinesRevision = 0;
+}
+
 FVisualizationSystem::FVisualizationSettings& FVisualizationSystem::GetSettings()
 {
 	return Settings;
@@ -0,0 +1,53 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ModuleDiscovery.h"
+
+struct FModuleCatalogDelta;
+
+/**
+ * Module catalog partitioned by EStationModuleGroup, then by ModuleType
+ * 
+ * Each group keeps its modules sorted by type and name, so a group or a single type
+ * within it is one contiguous range. Queries return views into that storage instead
+ * of copying FModuleInfo; a view is only valid until the catalog next changes.
+ */
+class FModuleCatalog
+{
+public:
+	/** Remove every module */
+	void Reset();
+
+	/** Apply an add/remove delta, sorting each touched group once; the only way modules enter or leave the catalog */
+	void ApplyDelta(const FModuleCatalogDelta& Delta);
+
+	/** Modules in a group sorted by type then name; EStationModuleGroup::All returns everything */
+	TConstArrayView<TSharedPtr<FModuleInfo>> GetModules(EStationModuleGroup Group) const;
+
+	/** Modules of one type within a group */
+	TConstArrayView<TSharedPtr<FModuleInfo>> GetModules(EStationModuleGroup Group, const FString& ModuleType) const;
+
+	/** Distinct module types present in a group */
+	void GetModuleTypes(EStationModuleGroup Group, TArray<FString>& OutTypes) const;
+
+	/** Total number of modules */
+	int32 Num() const { return GetModules(EStationModuleGroup::All).Num(); }
+
+private:
+	/** Sorted modules of one group and the range each type occupies */
+	struct FGroupBucket
+	{
+		TArray<TSharedPtr<FModuleInfo>> Modules;
+		TMap<FString, TPair<int32, int32>> TypeRanges;
+	};
+
+	/** Recompute the type ranges after the bucket's modules changed */
+	static void RebuildTypeRanges(FGroupBucket& Bucket);
+
+	/** Catalog sort order: type, then name, then path to keep duplicates stable */
+	static bool SortsBefore(const FModuleInfo& A, const FModuleInfo& B);
+
+	TMap<EStationModuleGroup, FGroupBucket> Buckets;
+};
@@ -0,0 +1,73 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ModuleDiscovery.h"
+
+struct FAssetData;
+class IAssetRegistry;
+
+/**
+ * Persistent module discovery results, stored in Saved/StationDesigner/ModuleCatalog.json
+ * 
+ * Each Blueprint asset is recorded with a discovery stamp: its package's saved hash and
+ * size, its parent class path, and the package stamps of its Blueprint ancestors. Discovery
+ * only re-evaluates assets whose stamp changed since the catalog was written, including
+ * children of a reparented Blueprint. Non-module Blueprints are recorded too, so they are
+ * not re-checked either. Catalogs written by a build with a different
+ * ADASTREA_INTEGRATION_ENABLED setting are discarded.
+ */
+class FModuleCatalogCache
+{
+public:
+	/** Get the shared catalog, loading it from disk on first use */
+	static FModuleCatalogCache& Get();
+
+	/**
+	 * Look up a cached discovery result
+	 * @param ObjectPath Blueprint object path
+	 * @param PackageStamp Current discovery stamp of the Blueprint (see GetDiscoveryStamp)
+	 * @param bOutIsModule Whether the Blueprint is a station module
+	 * @param OutInfo Module info when bOutIsModule is true
+	 * @return False if the asset is unknown or its package changed
+	 */
+	bool Find(const FString& ObjectPath, const FString& PackageStamp, bool& bOutIsModule, FModuleInfo& OutInfo) const;
+
+	/** Record a discovery result for an asset */
+	void Store(const FString& ObjectPath, const FString& PackageStamp, bool bIsModule, const FModuleInfo& Info);
+
+	/** Forget an asset */
+	void Remove(const FString& ObjectPath);
+
+	/** Forget every asset not in the set (deleted or moved since the last scan) */
+	void RetainOnly(const TSet<FString>& ObjectPaths);
+
+	/** Write the catalog to disk if it changed */
+	bool SaveIfDirty();
+
+	/** Build the change stamp for an asset's package, empty if the registry has no package data */
+	static FString GetPackageStamp(const IAssetRegistry& AssetRegistry, const FAssetData& AssetData);
+
+	/** Build the stamp catalog entries are keyed on: the package stamp plus the parent class chain */
+	static FString GetDiscoveryStamp(const IAssetRegistry& AssetRegistry, const FAssetData& AssetData);
+
+	/** Catalog file location */
+	static FString GetCacheFilePath();
+
+private:
+	FModuleCatalogCache();
+
+	/** Read the catalog file, ignoring it if missing or from another format version */
+	void Load();
+
+	struct FEntry
+	{
+		FString PackageStamp;
+		bool bIsModule = false;
+		FModuleInfo Info;
+	};
+
+	TMap<FString, FEntry> Entries;
+	bool bDirty;
+};
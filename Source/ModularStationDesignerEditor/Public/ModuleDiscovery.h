@@ -5,7 +5,7 @@
 #include "CoreMinimal.h"
 #include "StationDesignerTypes.h"
 
-class UBlueprint;
+struct FAssetData;
 
 /**
  * Information about a discovered module
@@ -31,6 +31,18 @@ struct FModuleInfo
 
 /**
  * Module discovery system - scans for Adastrea station modules
+ * 
+ * Module properties are resolved in three steps:
+ * 1. Asset registry tags on the Blueprint (e.g. AssetRegistrySearchable properties on the
+ *    module class), read without loading anything:
+ *    - ModuleType:  module type display string
+ *    - ModulePower: power consumption in MW (negative generates power)
+ *    - ModuleGroup: EStationModuleGroup value name, e.g. "Docking"
+ * 2. If any tag is missing and Adastrea integration is enabled, the Blueprint's generated
+ *    class is loaded and its class default object supplies the values
+ * 3. Otherwise the values are inferred from the Blueprint name
+ *
+ * Results are cached per package stamp, so a Blueprint is loaded at most once until it changes.
  */
 class FModuleDiscovery
 {
@@ -38,12 +50,32 @@ public:
 	// Discover all station modules in the project
 	static TArray<FModuleInfo> DiscoverModules();
 	
-	// Discover modules with filter
-	static TArray<FModuleInfo> DiscoverModulesFiltered(EStationModuleGroup GroupFilter);
+	// Modules in a group (optionally of one type) from the live catalog, valid until the catalog next changes
+	static TConstArrayView<TSharedPtr<FModuleInfo>> DiscoverModulesFiltered(EStationModuleGroup GroupFilter, const FString& ModuleType = FString());
+
+	// Build module info for a Blueprint asset from its registry tags, returns false if it is not a station module
+	static bool TryExtractModuleInfo(const FAssetData& AssetData, FModuleInfo& OutInfo);
+
+	// Asset registry tag names read by discovery
+	static const FName ModuleTypeTag;
+	static const FName ModulePowerTag;
+	static const FName ModuleGroupTag;
 
 private:
-	// Helper to extract module metadata from Blueprint
-	static FModuleInfo ExtractModuleInfo(UBlueprint* Blueprint);
+	// Helper to build module metadata from Blueprint tags, loading the class default object only when tags are missing
+	static FModuleInfo BuildModuleInfo(const FAssetData& AssetData);
+	
+	// Read module type, power and group from the generated class's CDO (false without Adastrea integration)
+	static bool ReadModuleInfoFromClassDefault(const FAssetData& AssetData, FModuleInfo& InOutInfo);
+	
+	// Check whether a Blueprint asset generates a station module class without loading it
+	static bool IsStationModuleAsset(const FAssetData& AssetData);
+	
+	// Helper to parse an EStationModuleGroup tag value
+	static bool ParseModuleGroup(const FString& Value, EStationModuleGroup& OutGroup);
+	
+	// Helper to infer power consumption from name
+	static float DeterminePowerConsumption(const FString& ModuleName);
 	
 	// Helper to determine module group from name
 	static EStationModuleGroup DetermineModuleGroup(const FString& ModuleName);
@@ -0,0 +1,104 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ModuleDiscovery.h"
+#include "ModuleCatalog.h"
+#include "ModuleSearchIndex.h"
+
+struct FAssetData;
+
+/**
+ * Change to the module catalog, pushed to listeners as it happens
+ * An updated module is reported as its old entry removed and a new entry added
+ */
+struct FModuleCatalogDelta
+{
+	TArray<TSharedPtr<FModuleInfo>> Added;
+	TArray<TSharedPtr<FModuleInfo>> Removed;
+
+	bool IsEmpty() const { return Added.Num() == 0 && Removed.Num() == 0; }
+};
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnModuleCatalogChanged, const FModuleCatalogDelta&);
+
+/**
+ * Live module catalog kept in sync with the asset registry
+ * 
+ * Runs one full discovery once the registry has finished its initial scan, then patches
+ * the catalog one asset at a time from registry add/remove/rename/update events.
+ * Entries are shared and never modified in place, so listeners can hold on to them.
+ */
+class FModuleDiscoveryService
+{
+public:
+	/** Get the shared service, subscribing to the asset registry on first use */
+	static FModuleDiscoveryService& Get();
+
+	/** Destroy the shared service and unbind its registry delegates (module shutdown) */
+	static void Shutdown();
+
+	/** Check whether the shared service exists, without creating it */
+	static bool IsAvailable() { return Instance.IsValid(); }
+
+	~FModuleDiscoveryService();
+
+	/** Current modules, empty until the registry's initial scan has completed */
+	void GetModules(TArray<TSharedPtr<FModuleInfo>>& OutModules) const;
+
+	/** Current modules indexed by group and type, updated before OnCatalogChanged fires */
+	const FModuleCatalog& GetCatalog() const { return Catalog; }
+
+	/** Current modules indexed for palette search, updated before OnCatalogChanged fires */
+	const FModuleSearchIndex& GetSearchIndex() const { return SearchIndex; }
+
+	/** Full rediscovery, broadcasting whatever differs from the current catalog */
+	void Rescan();
+
+	/** True once the first full discovery has run */
+	bool IsCatalogReady() const { return bCatalogReady; }
+
+	/** Broadcast on the game thread whenever modules are added, removed or changed */
+	FOnModuleCatalogChanged& OnCatalogChanged() { return CatalogChanged; }
+
+private:
+	FModuleDiscoveryService();
+
+	void HandleFilesLoaded();
+	void HandleAssetAdded(const FAssetData& AssetData);
+	void HandleAssetRemoved(const FAssetData& AssetData);
+	void HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+	void HandleAssetUpdated(const FAssetData& AssetData);
+
+	/** Re-evaluate one Blueprint and record the result in Delta */
+	void PatchAsset(const FAssetData& AssetData, FModuleCatalogDelta& Delta);
+
+	/** Drop one module by object path and record it in Delta */
+	void RemoveModule(const FString& ObjectPath, FModuleCatalogDelta& Delta);
+
+	void Broadcast(const FModuleCatalogDelta& Delta);
+
+	/** Only plain Blueprint assets are considered, matching FModuleDiscovery */
+	static bool IsBlueprintAsset(const FAssetData& AssetData);
+
+	static bool HasSameProperties(const FModuleInfo& A, const FModuleInfo& B);
+
+	/** Modules by Blueprint object path */
+	TMap<FString, TSharedPtr<FModuleInfo>> ModulesByPath;
+
+	/** The same modules partitioned for filtered queries */
+	FModuleCatalog Catalog;
+	FModuleSearchIndex SearchIndex;
+
+	FOnModuleCatalogChanged CatalogChanged;
+	bool bCatalogReady;
+
+	FDelegateHandle FilesLoadedHandle;
+	FDelegateHandle AssetAddedHandle;
+	FDelegateHandle AssetRemovedHandle;
+	FDelegateHandle AssetRenamedHandle;
+	FDelegateHandle AssetUpdatedHandle;
+
+	static TUniquePtr<FModuleDiscoveryService> Instance;
+};
@@ -6,6 +6,8 @@
 #include "Widgets/SCompoundWidget.h"
 #include "ModuleDiscovery.h"
 
+struct FModuleCatalogDelta;
+
 class SSearchBox;
 template <typename ItemType> class SListView;
 
@@ -21,12 +23,13 @@ public:
 	/** Constructs this widget with InArgs */
 	void Construct(const FArguments& InArgs);
 
-	/** Refresh module list */
+	virtual ~SModulePalette();
+
+	/** Force a full rediscovery; changes arrive through the catalog delta */
 	void RefreshModuleList();
 
 private:
-	// Module list data
-	TArray<TSharedPtr<FModuleInfo>> AllModules;
+	// Modules shown in the list, a filtered subset of the catalog
 	TArray<TSharedPtr<FModuleInfo>> FilteredModules;
 	
 	// Current filter
@@ -54,6 +57,20 @@ private:
 	// Apply current filters
 	void ApplyFilters();
 
+	// Run the search once typing has paused
+	EActiveTimerReturnType OnSearchDebounceElapsed(double InCurrentTime, float InDeltaTime);
+
+	// Pending search, restarted on every keystroke
+	TSharedPtr<FActiveTimerHandle> SearchDebounceTimer;
+
+	// Seconds without typing before the search runs
+	static constexpr float SearchDebounceDelay = 0.15f;
+
+	// Refresh the list from the catalog after modules are added or removed
+	void OnModuleCatalogChanged(const FModuleCatalogDelta& Delta);
+
+	FDelegateHandle CatalogChangedHandle;
+
 	// Create group filter buttons
 	TSharedRef<SWidget> CreateGroupFilters();
 };
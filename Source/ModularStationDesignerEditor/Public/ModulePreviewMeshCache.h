@@ -0,0 +1,83 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/SoftObjectPath.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+#include "UObject/UObjectGlobals.h"
+
+class UStaticMesh;
+class UMaterialInterface;
+
+/**
+ * Process-wide cache of the preview mesh, materials and bounds resolved from module blueprints
+ * 
+ * Shared by every station viewport so the blueprint CDO is only walked once per class.
+ * Entries hold weak references and are dropped when a blueprint is recompiled or a
+ * package is reloaded; the generation counter lets viewports notice and rebuild previews.
+ */
+class FModulePreviewMeshCache
+{
+public:
+	/** Resolved preview data for one blueprint */
+	struct FEntry
+	{
+		TWeakObjectPtr<UStaticMesh> Mesh;
+		TArray<TWeakObjectPtr<UMaterialInterface>> Materials;
+		FBox LocalBounds = FBox(ForceInit);
+
+		/** False when the blueprint loaded but has no usable static mesh */
+		bool bHasMesh = false;
+	};
+
+	/** Get the shared cache */
+	static FModulePreviewMeshCache& Get();
+
+	/** Destroy the shared cache and unbind its editor delegates (module shutdown) */
+	static void Shutdown();
+
+	~FModulePreviewMeshCache();
+
+	/**
+	 * Get the preview mesh for a blueprint, resolving and caching it on a miss
+	 * Loads the class if it is not in memory yet, so call after any async load completes
+	 * @param BlueprintPath Module blueprint class
+	 * @param OutMaterials Materials of the preview mesh component
+	 * @param OutLocalBounds Optional mesh bounds in component space
+	 * @return The static mesh, or nullptr if the blueprint has none
+	 */
+	UStaticMesh* Resolve(const FSoftClassPath& BlueprintPath, TArray<UMaterialInterface*>& OutMaterials, FBox* OutLocalBounds = nullptr);
+
+	/** Get the mesh bounds of an already resolved blueprint without loading anything */
+	bool FindLocalBounds(const FSoftClassPath& BlueprintPath, FBox& OutLocalBounds) const;
+
+	/** Check whether a blueprint is already known to have no preview mesh */
+	bool IsKnownWithoutMesh(const FSoftClassPath& BlueprintPath) const;
+
+	/** Drop one blueprint's entry */
+	void Invalidate(const FSoftClassPath& BlueprintPath);
+
+	/** Drop every entry */
+	void InvalidateAll();
+
+	/** Incremented whenever entries are invalidated */
+	uint32 GetGeneration() const { return Generation; }
+
+private:
+	FModulePreviewMeshCache();
+
+	/** Walk a blueprint CDO for its first static mesh component */
+	static bool BuildEntry(const FSoftClassPath& BlueprintPath, FEntry& OutEntry);
+
+	void HandleBlueprintCompiled();
+	void HandlePackageReloaded(EPackageReloadPhase Phase, FPackageReloadedEvent* Event);
+
+	TMap<FSoftClassPath, FEntry> Entries;
+	uint32 Generation;
+
+	FDelegateHandle BlueprintCompiledHandle;
+	FDelegateHandle PackageReloadedHandle;
+
+	static TUniquePtr<FModulePreviewMeshCache> Instance;
+};
@@ -0,0 +1,94 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ModuleDiscovery.h"
+
+struct FModuleCatalogDelta;
+
+/**
+ * Prebuilt search index over module names and types for the palette
+ * 
+ * Text is lowercased once when a module is added. Each term of a query is resolved through
+ * a word-prefix trie (terms shorter than three characters) or trigram postings (longer
+ * terms, tolerating roughly one typo in three trigrams), so a keystroke only touches the
+ * postings of the query's own trigrams instead of every module.
+ * Removed modules are tombstoned and compacted away in bulk.
+ */
+class FModuleSearchIndex
+{
+public:
+	FModuleSearchIndex();
+
+	/** Remove every module */
+	void Reset();
+
+	/** Index a module */
+	void Add(const TSharedPtr<FModuleInfo>& Module);
+
+	/** Remove an indexed module, returns false if it was not indexed */
+	bool Remove(const TSharedPtr<FModuleInfo>& Module);
+
+	/** Apply an add/remove delta */
+	void ApplyDelta(const FModuleCatalogDelta& Delta);
+
+	/**
+	 * Find modules matching every whitespace-separated term of the search text, best match first
+	 * @param SearchText Query as typed, must not be empty
+	 * @param GroupFilter Only return modules in this group (EStationModuleGroup::All for any)
+	 * @param OutResults Matching modules ranked by fuzzy score
+	 */
+	void Query(const FString& SearchText, EStationModuleGroup GroupFilter, TArray<TSharedPtr<FModuleInfo>>& OutResults) const;
+
+	/** Number of live indexed modules */
+	int32 Num() const { return Entries.Num() - NumRemoved; }
+
+private:
+	struct FEntry
+	{
+		TSharedPtr<FModuleInfo> Module;
+		FString LowerName;
+		FString LowerType;
+	};
+
+	struct FTrieNode
+	{
+		/** Child node index per next character */
+		TArray<TPair<TCHAR, int32>> Children;
+
+		/** Entries with a word starting with this node's prefix, ascending */
+		TArray<int32> EntryIds;
+	};
+
+	/** Lowercase words of a name, split at separators and camelCase boundaries */
+	static void Tokenize(const FString& Text, TArray<FString>& OutWords);
+
+	/** Pack three lowercase characters into a postings key */
+	static uint64 MakeTrigram(const TCHAR* Chars);
+
+	void IndexEntry(int32 EntryId);
+	void AddTrigrams(const FString& LowerText, int32 EntryId);
+	void AddWord(const FString& Word, int32 EntryId);
+
+	/** Walk the trie, returns INDEX_NONE if no word starts with the prefix */
+	int32 FindTrieNode(const FString& Prefix) const;
+
+	/** Collect live candidates for one lowercase term into OutCandidates (ascending ids) */
+	void FindCandidates(const FString& Term, TArray<int32>& OutCandidates) const;
+
+	/** Score how well an entry matches one lowercase term, higher is better */
+	float ScoreTerm(const FEntry& Entry, const FString& Term) const;
+
+	/** Drop tombstoned entries and rebuild the postings */
+	void Compact();
+
+	TArray<FEntry> Entries;
+	TMap<TSharedPtr<FModuleInfo>, int32> EntryIdByModule;
+	TMap<uint64, TArray<int32>> TrigramPostings;
+	TArray<FTrieNode> TrieNodes;
+	int32 NumRemoved;
+
+	/** Per-entry trigram hit counts, reused between queries */
+	mutable TArray<uint16> ScratchHits;
+};
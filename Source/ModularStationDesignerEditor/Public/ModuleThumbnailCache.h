@@ -0,0 +1,106 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/LruCache.h"
+#include "ModuleDiscovery.h"
+
+struct FSlateBrush;
+struct FModuleCatalogDelta;
+
+/**
+ * Palette thumbnails for module Blueprints, produced off the game thread
+ * 
+ * Sources, in order: the disk cache (keyed by object path and package stamp), the
+ * thumbnail saved inside the Blueprint's package, then a silhouette drawn from the
+ * preview mesh bounds. Decoding and downscaling run on a worker; only brush creation
+ * happens on the game thread. Brushes live in a size-bounded LRU, and rows only
+ * request a thumbnail while they are painted, so off-screen modules cost nothing.
+ */
+class FModuleThumbnailCache
+{
+public:
+	/** Get the shared cache */
+	static FModuleThumbnailCache& Get();
+
+	/** Destroy the shared cache, dropping any results still in flight (module shutdown) */
+	static void Shutdown();
+
+	/** Check whether the shared cache exists, without creating it */
+	static bool IsAvailable() { return Instance.IsValid(); }
+
+	~FModuleThumbnailCache();
+
+	/**
+	 * Get a module's thumbnail, queuing generation on a miss
+	 * Call every paint while the module is visible; the most recently requested are generated first
+	 * @return The thumbnail brush, or nullptr while it is being generated or if generation failed
+	 */
+	const FSlateBrush* RequestThumbnail(const FModuleInfo& Module);
+
+	/** Thumbnail edge length in pixels */
+	static constexpr int32 ThumbnailSize = 64;
+
+private:
+	FModuleThumbnailCache();
+
+	/** Everything a worker needs, gathered on the game thread */
+	struct FThumbnailJob
+	{
+		FString ObjectPath;
+		FString PackageFilename;
+		FName ObjectFullName;
+		FString PackageStamp;
+		FString DiskCachePath;
+		FBox SilhouetteBounds = FBox(ForceInit);
+		FColor SilhouetteColor = FColor::White;
+	};
+
+	/** Start queued jobs up to the in-flight limit, most recently requested first */
+	void DispatchQueued();
+
+	/** Fill a job from the asset registry and preview mesh cache */
+	void PrepareJob(const FString& ObjectPath, EStationModuleGroup Group, FThumbnailJob& OutJob) const;
+
+	/** Worker: BGRA8 pixels from the disk cache, then package thumbnail, then silhouette */
+	static TArray<uint8> GenerateThumbnail(const FThumbnailJob& Job);
+
+	/** Disk cache files are keyed on the object path and hold the package stamp they were made from */
+	static bool LoadFromDiskCache(const FString& CachePath, const FString& PackageStamp, TArray<uint8>& OutBytes);
+	static void SaveToDiskCache(const FString& CachePath, const FString& PackageStamp, const TArray<uint8>& Bytes);
+	static bool LoadPackageThumbnail(const FThumbnailJob& Job, TArray<uint8>& OutBytes);
+	static void DrawSilhouette(const FBox& Bounds, const FColor& Color, TArray<uint8>& OutBytes);
+
+	/** Box-filter BGRA8 pixels down (or up) to ThumbnailSize squared */
+	static void Resample(const TArray<uint8>& Source, int32 SourceWidth, int32 SourceHeight, TArray<uint8>& OutBytes);
+
+	void HandleThumbnailReady(const FString& ObjectPath, uint32 JobId, TArray<uint8>&& Pixels);
+	void HandleCatalogChanged(const FModuleCatalogDelta& Delta);
+
+	struct FQueuedRequest
+	{
+		EStationModuleGroup Group = EStationModuleGroup::Other;
+		uint64 LastRequestedFrame = 0;
+	};
+
+	/** Ready brushes by Blueprint object path */
+	TLruCache<FString, TSharedPtr<FSlateBrush>> Brushes;
+
+	/** Waiting for a worker slot */
+	TMap<FString, FQueuedRequest> Queued;
+
+	/** Handed to a worker, with the job id so results for dropped requests are ignored */
+	TMap<FString, uint32> InFlight;
+	uint32 NextJobId;
+
+	/** Brush creation failed; not requeued until the module changes */
+	TSet<FString> Failed;
+
+	/** Keeps dynamic brush resource names unique */
+	uint32 BrushSerial;
+
+	FDelegateHandle CatalogChangedHandle;
+
+	static TUniquePtr<FModuleThumbnailCache> Instance;
+};
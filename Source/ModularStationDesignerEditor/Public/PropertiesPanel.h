@@ -5,6 +5,9 @@
 #include "CoreMinimal.h"
 #include "Widgets/SCompoundWidget.h"
 #include "StationDesignerTypes.h"
+#include "StationValidator.h"
+
+class SVerticalBox;
 
 /**
  * Properties Panel Widget
@@ -28,6 +31,12 @@ public:
 	
 	/** Clear the selection */
 	void ClearSelection();
+	
+	/** Replace the displayed validation results */
+	void SetValidationResults(const TArray<FValidationMessage>& Messages);
+	
+	/** Show that validation is running for the latest edit */
+	void SetValidationPending();
 
 private:
 	// Current data
@@ -45,6 +54,7 @@ private:
 	TSharedPtr<SWidget> ModulePropertiesWidget;
 	TSharedPtr<SWidget> StatisticsWidget;
 	TSharedPtr<SWidget> ValidationResultsWidget;
+	TSharedPtr<SVerticalBox> ValidationMessagesBox;
 	
 	// Helper methods
 	FText GetStationName() const;
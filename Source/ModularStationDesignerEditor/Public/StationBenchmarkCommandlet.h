@@ -0,0 +1,38 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "StationDesignerTypes.h"
+#include "StationBenchmarkCommandlet.generated.h"
+
+/**
+ * Headless benchmark for the station designer hot paths
+ * Generates synthetic station designs and times validation, visualization,
+ * file I/O and advanced tools, then times palette search over a synthetic
+ * module catalog, writing the results as JSON
+ * 
+ * Usage:
+ *   UnrealEditor-Cmd <Project> -run=StationBenchmark -nullrhi
+ *     [-Sizes=100,1000,10000] [-Iterations=3] [-SearchSize=10000] [-Output=<path to json>]
+ */
+UCLASS()
+class UStationBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UStationBenchmarkCommandlet();
+
+	// UCommandlet interface
+	virtual int32 Main(const FString& Params) override;
+
+	/**
+	 * Build a synthetic station design
+	 * @param NumModules Number of modules to place
+	 * @param Seed Random seed for connections and module mix
+	 * @return A connected design with docking, power, storage and trade modules
+	 */
+	static FStationDesign GenerateSyntheticDesign(int32 NumModules, int32 Seed = 1);
+};
@@ -0,0 +1,64 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "StationDesignerTypes.h"
+
+struct FStationFileMetadata;
+
+/**
+ * Compact binary station design format (version 2)
+ * 
+ * Layout, little-endian, every section 8-byte aligned:
+ * - Header: magic, version, counts and section offsets
+ * - Metadata: content hash, then the UTF-8 station name and design version, so
+ *   FStationFileMetadata is readable from the first bytes of the file (version 2+)
+ * - String table: uint32 offsets (StringCount + 1) into a UTF-8 blob; IDs, Blueprint paths
+ *   and names are stored once and referenced by index
+ * - Modules: one packed record per module (string indices plus a float location,
+ *   rotation quaternion and scale)
+ * - Connections: CSR arrays, uint32 offsets (ModuleCount + 1) and the string index of
+ *   each connected module ID, so unresolved IDs round-trip unchanged
+ * 
+ * Loading maps the file and reads the sections in place without any JSON. Transforms
+ * are stored in single precision. JSON remains the interchange format; both share the
+ * .station extension and FStationFileHelper tells them apart by the magic number.
+ */
+class FStationBinaryFormat
+{
+public:
+	/** First four bytes of a binary station file ('MSDB') */
+	static constexpr uint32 Magic = 0x4244534D;
+
+	/** Current format version */
+	static constexpr uint16 Version = 2;
+
+	/**
+	 * Write a design in the binary format
+	 * @param Design Station design to save
+	 * @param FilePath Full path of the file to write
+	 * @return True if save successful
+	 */
+	static bool Save(const FStationDesign& Design, const FString& FilePath);
+
+	/**
+	 * Read a binary station file
+	 * @param FilePath Full path of the file to read
+	 * @param OutDesign Loaded design, with its module index rebuilt
+	 * @return True if the file is a valid binary station file
+	 */
+	static bool Load(const FString& FilePath, FStationDesign& OutDesign);
+
+	/**
+	 * Read only the header and metadata block
+	 * @return False if the file is not a binary station file or predates the metadata block
+	 */
+	static bool ReadMetadata(const FString& FilePath, FStationFileMetadata& OutMetadata);
+
+	/** Check whether a file starts with the binary magic number */
+	static bool IsBinaryFile(const FString& FilePath);
+
+	/** Parse a binary design from memory */
+	static bool LoadFromMemory(const uint8* Data, int64 DataSize, FStationDesign& OutDesign);
+};
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "StationDesignerTypes.h"
+#include "StationConnectivityTracker.h"
 
 /**
  * Base class for undoable commands
@@ -22,6 +23,15 @@ public:
 	
 	/** Get a description of this command for UI display */
 	virtual FString GetDescription() const = 0;
+	
+	/**
+	 * Apply this command's effect to the connectivity tracker after Execute (or Undo if bUndo)
+	 * Defaults to invalidating the tracker so unknown commands stay correct
+	 */
+	virtual void UpdateConnectivity(FStationConnectivityTracker& Tracker, bool bUndo) const
+	{
+		Tracker.Invalidate();
+	}
 };
 
 /**
@@ -37,16 +47,25 @@ public:
 	
 	virtual void Execute(FStationDesign& Design) override
 	{
-		Design.Modules.Add(Module);
+		Design.AddModule(Module);
 	}
 	
 	virtual void Undo(FStationDesign& Design) override
 	{
 		// Remove the module by ID
-		Design.Modules.RemoveAll([this](const FModulePlacement& M)
+		Design.RemoveModule(Module.ModuleID);
+	}
+	
+	virtual void UpdateConnectivity(FStationConnectivityTracker& Tracker, bool bUndo) const override
+	{
+		if (bUndo)
 		{
-			return M.ModuleID == Module.ModuleID;
-		});
+			Tracker.OnModuleRemoved(Module.ModuleID);
+		}
+		else
+		{
+			Tracker.OnModuleAdded(Module);
+		}
 	}
 	
 	virtual FString GetDescription() const override
@@ -71,27 +90,34 @@ public:
 	
 	virtual void Execute(FStationDesign& Design) override
 	{
-		// Find and store the module before removing it
-		for (const FModulePlacement& M : Design.Modules)
+		// Store the module and its slot while removing it so Undo can restore it in place
+		RemovedIndex = Design.FindModuleIndex(ModuleID);
+		Design.RemoveModule(ModuleID, &RemovedModule);
+	}
+	
+	virtual void Undo(FStationDesign& Design) override
+	{
+		// Re-add the removed module at its original position
+		if (RemovedIndex != INDEX_NONE)
 		{
-			if (M.ModuleID == ModuleID)
-			{
-				RemovedModule = M;
-				break;
-			}
+			Design.InsertModule(RemovedIndex, RemovedModule);
 		}
-		
-		// Remove the module
-		Design.Modules.RemoveAll([this](const FModulePlacement& M)
+		else
 		{
-			return M.ModuleID == ModuleID;
-		});
+			Design.AddModule(RemovedModule);
+		}
 	}
 	
-	virtual void Undo(FStationDesign& Design) override
+	virtual void UpdateConnectivity(FStationConnectivityTracker& Tracker, bool bUndo) const override
 	{
-		// Re-add the removed module
-		Design.Modules.Add(RemovedModule);
+		if (bUndo)
+		{
+			Tracker.OnModuleAdded(RemovedModule);
+		}
+		else
+		{
+			Tracker.OnModuleRemoved(ModuleID);
+		}
 	}
 	
 	virtual FString GetDescription() const override
@@ -102,6 +128,7 @@ public:
 private:
 	FString ModuleID;
 	FModulePlacement RemovedModule;
+	int32 RemovedIndex = INDEX_NONE;
 };
 
 /**
@@ -119,30 +146,29 @@ public:
 	virtual void Execute(FStationDesign& Design) override
 	{
 		// Find module and store old transform
-		for (FModulePlacement& M : Design.Modules)
+		if (FModulePlacement* M = Design.FindModule(ModuleID))
 		{
-			if (M.ModuleID == ModuleID)
-			{
-				OldTransform = M.Transform;
-				M.Transform = NewTransform;
-				break;
-			}
+			OldTransform = M->Transform;
+			M->Transform = NewTransform;
+			Design.MarkModified();
 		}
 	}
 	
 	virtual void Undo(FStationDesign& Design) override
 	{
 		// Restore old transform
-		for (FModulePlacement& M : Design.Modules)
+		if (FModulePlacement* M = Design.FindModule(ModuleID))
 		{
-			if (M.ModuleID == ModuleID)
-			{
-				M.Transform = OldTransform;
-				break;
-			}
+			M->Transform = OldTransform;
+			Design.MarkModified();
 		}
 	}
 	
+	virtual void UpdateConnectivity(FStationConnectivityTracker& Tracker, bool bUndo) const override
+	{
+		// Moving a module does not change its connections
+	}
+	
 	virtual FString GetDescription() const override
 	{
 		return FString::Printf(TEXT("Move Module: %s"), *ModuleID);
@@ -168,33 +194,47 @@ public:
 	
 	virtual void Execute(FStationDesign& Design) override
 	{
-		// Add connections
-		for (FModulePlacement& M : Design.Modules)
+		// Resolve both ends to module handles once, then add connections
+		const int32 HandleA = Design.FindModuleIndex(ModuleAID);
+		const int32 HandleB = Design.FindModuleIndex(ModuleBID);
+		
+		if (HandleA != INDEX_NONE)
 		{
-			if (M.ModuleID == ModuleAID)
-			{
-				M.ConnectedModuleIDs.AddUnique(ModuleBID);
-			}
-			else if (M.ModuleID == ModuleBID)
-			{
-				M.ConnectedModuleIDs.AddUnique(ModuleAID);
-			}
+			Design.Modules[HandleA].ConnectedModuleIDs.AddUnique(ModuleBID);
 		}
+		if (HandleB != INDEX_NONE)
+		{
+			Design.Modules[HandleB].ConnectedModuleIDs.AddUnique(ModuleAID);
+		}
+		Design.MarkModified();
 	}
 	
 	virtual void Undo(FStationDesign& Design) override
 	{
-		// Remove connections
-		for (FModulePlacement& M : Design.Modules)
+		// Resolve both ends to module handles once, then remove connections
+		const int32 HandleA = Design.FindModuleIndex(ModuleAID);
+		const int32 HandleB = Design.FindModuleIndex(ModuleBID);
+		
+		if (HandleA != INDEX_NONE)
+		{
+			Design.Modules[HandleA].ConnectedModuleIDs.Remove(ModuleBID);
+		}
+		if (HandleB != INDEX_NONE)
+		{
+			Design.Modules[HandleB].ConnectedModuleIDs.Remove(ModuleAID);
+		}
+		Design.MarkModified();
+	}
+	
+	virtual void UpdateConnectivity(FStationConnectivityTracker& Tracker, bool bUndo) const override
+	{
+		if (bUndo)
 		{
-			if (M.ModuleID == ModuleAID)
-			{
-				M.ConnectedModuleIDs.Remove(ModuleBID);
-			}
-			else if (M.ModuleID == ModuleBID)
-			{
-				M.ConnectedModuleIDs.Remove(ModuleAID);
-			}
+			Tracker.OnModulesDisconnected(ModuleAID, ModuleBID);
+		}
+		else
+		{
+			Tracker.OnModulesConnected(ModuleAID, ModuleBID);
 		}
 	}
 	
@@ -264,8 +304,15 @@ public:
 	 */
 	void SetMaxHistorySize(int32 Size) { MaxHistorySize = FMath::Max(1, Size); }
 	
+	/**
+	 * Get the connectivity tracker kept in sync by executed, undone and redone commands
+	 * Call Refresh with the design before querying it
+	 */
+	FStationConnectivityTracker& GetConnectivityTracker() { return ConnectivityTracker; }
+	
 private:
 	TArray<TSharedPtr<IStationCommand>> UndoStack;
 	TArray<TSharedPtr<IStationCommand>> RedoStack;
 	int32 MaxHistorySize = 50;
+	FStationConnectivityTracker ConnectivityTracker;
 };
@@ -5,10 +5,13 @@
 #include "CoreMinimal.h"
 #include "Widgets/SCompoundWidget.h"
 #include "StationDesignerTypes.h"
+#include "StationCommandManager.h"
 
 class SModulePalette;
 class SStationViewport;
 class SPropertiesPanel;
+class FStationValidationService;
+struct FValidationMessage;
 
 /**
  * Main Station Designer Window (Slate UI)
@@ -27,11 +30,17 @@ private:
 	// Current station design
 	FStationDesign CurrentDesign;
 
+	// Undo history for viewport edits, also keeps the connectivity tracker current for validation
+	FStationCommandManager CommandManager;
+
 	// UI Components
 	TSharedPtr<SModulePalette> ModulePalette;
 	TSharedPtr<SStationViewport> StationViewport;
 	TSharedPtr<SPropertiesPanel> PropertiesPanel;
 
+	// Background validation of the current design
+	TSharedPtr<FStationValidationService> ValidationService;
+
 	// UI event handlers
 	FReply OnNewStation();
 	FReply OnLoadStation();
@@ -50,6 +59,10 @@ private:
 
 	// Helper methods
 	void UpdateUI();
+	void OnDesignChanged();
+	void RequestValidation();
+	void ResetCommandHistory();
+	void OnValidationComplete(const TArray<FValidationMessage>& Messages);
 	void SaveStationToFile(const FString& FilePath);
 	void LoadStationFromFile(const FString& FilePath);
 };
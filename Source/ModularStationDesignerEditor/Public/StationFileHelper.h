@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "StationDesignerTypes.h"
+#include "StationFileMetadata.h"
 
 /**
  * File I/O utilities for station designs
@@ -22,7 +23,15 @@ public:
 	static bool SaveStationToFile(const FStationDesign& Design, const FString& FilePath, bool bPrettyPrint = true);
 	
 	/**
-	 * Load a station design from a JSON file
+	 * Save a station design in the compact binary format (see FStationBinaryFormat)
+	 * @param Design The station design to save
+	 * @param FilePath Full path to save file
+	 * @return True if save successful
+	 */
+	static bool SaveStationToBinaryFile(const FStationDesign& Design, const FString& FilePath);
+	
+	/**
+	 * Load a station design from a JSON or binary file (detected from the file's magic number)
 	 * @param FilePath Full path to load file
 	 * @param OutDesign The loaded station design
 	 * @return True if load successful
@@ -37,19 +46,30 @@ public:
 	
 	/**
 	 * Get list of available station design files
-	 * @return Array of file paths
+	 * Read from the cached library index rather than scanning the directory
+	 * @return Array of file paths, newest first
 	 */
 	static TArray<FString> GetAvailableStationFiles();
 	
 	/**
 	 * Check if a file is a valid station design file
+	 * Only the metadata block is read; files saved before it existed are fully parsed
 	 * @param FilePath Path to check
 	 * @return True if valid station file
 	 */
 	static bool IsValidStationFile(const FString& FilePath);
 	
 	/**
-	 * Get file info for a station design
+	 * Read the metadata block at the start of a station file (JSON or binary)
+	 * Falls back to a full parse for files saved before the metadata block existed
+	 * @param FilePath Path to station file
+	 * @param OutMetadata Station name, version, module count and content hash
+	 * @return True if the file is a readable station file
+	 */
+	static bool ReadStationFileMetadata(const FString& FilePath, FStationFileMetadata& OutMetadata);
+	
+	/**
+	 * Get file info for a station design from its metadata block
 	 * @param FilePath Path to station file
 	 * @param OutName Station name from file
 	 * @param OutModuleCount Number of modules
@@ -77,7 +97,7 @@ public:
 	 * Export station design to a different format (for debugging/inspection)
 	 * @param Design Station design to export
 	 * @param FilePath Output file path
-	 * @param Format Export format ("json", "xml", "csv")
+	 * @param Format Export format ("json", "binary", "csv")
 	 * @return True if export successful
 	 */
 	static bool ExportStationDesign(const FStationDesign& Design, const FString& FilePath, const FString& Format = TEXT("json"));
@@ -92,4 +112,9 @@ private:
 	 * Generate a unique filename
 	 */
 	static FString GenerateUniqueFilename(const FString& Directory, const FString& BaseName, const FString& Extension);
+	
+	/**
+	 * Update the library index after writing or deleting a design
+	 */
+	static void NotifyLibraryFileChanged(const FString& FilePath);
 };
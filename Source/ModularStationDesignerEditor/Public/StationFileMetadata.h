@@ -0,0 +1,36 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "StationDesignerTypes.h"
+
+/**
+ * Summary written at the start of every station file
+ * 
+ * Lets file browsers and the library index read a design's name and size from the
+ * first few hundred bytes instead of parsing the whole file. JSON files carry it as a
+ * leading "metadata" object (ignored by FJsonObjectConverter), binary files as a block
+ * right after the header.
+ */
+struct FStationFileMetadata
+{
+	FString StationName;
+	FString DesignVersion;
+	int32 ModuleCount = 0;
+
+	/** Hash of the design contents at float transform precision, comparable across JSON and binary files */
+	uint64 ContentHash = 0;
+
+	/** Summarise a design */
+	static FStationFileMetadata FromDesign(const FStationDesign& Design);
+
+	/** Hash the fields that are written to a station file, transforms rounded to float as the binary format stores them */
+	static uint64 ComputeContentHash(const FStationDesign& Design);
+
+	/** Content hash as the fixed-width hex string stored in JSON */
+	FString GetContentHashString() const;
+
+	/** Parse a hash written by GetContentHashString */
+	bool SetContentHashFromString(const FString& HashString);
+};
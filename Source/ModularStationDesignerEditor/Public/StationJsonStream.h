@@ -0,0 +1,55 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "StationDesignerTypes.h"
+
+template <class CharType> class TJsonReader;
+struct FStationFileMetadata;
+
+/**
+ * Streaming JSON serialization specialised for FStationDesign
+ * 
+ * Writes UTF-8 JSON straight to an FArchive and parses token by token into the design's
+ * arrays, without building an FJsonObject tree. Output uses the same keys and layout as
+ * FJsonObjectConverter, and keys are matched case-insensitively on read, so files are
+ * interchangeable with the converter path used by templates and the exporter.
+ * 
+ * The first key is a "metadata" object (FStationFileMetadata), so a file's summary can
+ * be read from its first few hundred bytes.
+ */
+class FStationJsonStream
+{
+public:
+	/**
+	 * Write a design as JSON
+	 * @param Design Station design to write
+	 * @param Archive Destination, receives UTF-8 text
+	 * @param bPrettyPrint Whether to indent the output
+	 * @return True if the archive accepted all output
+	 */
+	static bool Write(const FStationDesign& Design, FArchive& Archive, bool bPrettyPrint);
+
+	/**
+	 * Parse a design from a JSON token stream
+	 * @param Reader Reader positioned before the root object
+	 * @param OutDesign Parsed design (module index not rebuilt)
+	 * @param ExpectedModuleCount Capacity to reserve for modules, if known
+	 * @return True if the root object parsed without errors
+	 */
+	template <class CharType>
+	static bool Read(TJsonReader<CharType>& Reader, FStationDesign& OutDesign, int32 ExpectedModuleCount = 0);
+
+	/**
+	 * Read only the leading metadata object from the first 4 KB of a JSON design file
+	 * @return False for files without a metadata object (written before it existed)
+	 */
+	static bool ReadMetadataFromFile(const FString& FilePath, FStationFileMetadata& OutMetadata);
+
+	/** Write a design to a JSON file */
+	static bool SaveToFile(const FStationDesign& Design, const FString& FilePath, bool bPrettyPrint);
+
+	/** Read a JSON design file (UTF-8, or UTF-16 with a byte order mark) and rebuild its module index */
+	static bool LoadFromFile(const FString& FilePath, FStationDesign& OutDesign);
+};
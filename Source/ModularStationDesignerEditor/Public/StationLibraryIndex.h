@@ -0,0 +1,84 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "StationFileMetadata.h"
+
+struct FFileChangeData;
+
+/**
+ * Persistent index of the designs in the StationDesigns directory
+ * 
+ * Stored as StationLibrary.index next to the designs. Each entry records the file's
+ * timestamp, size and metadata block, so listing the library needs no per-file stat or
+ * parse. On startup one directory scan picks up changes made while the editor was
+ * closed (only changed files are re-read); after that the index follows
+ * IDirectoryWatcher notifications and the file helper's own saves and deletes.
+ */
+class FStationLibraryIndex
+{
+public:
+	/** Indexed design file */
+	struct FEntry
+	{
+		FString FilePath;
+		FDateTime Timestamp;
+		int64 FileSize = 0;
+		FStationFileMetadata Metadata;
+	};
+
+	/** Get the shared index, loading it and watching the designs directory on first use */
+	static FStationLibraryIndex& Get();
+
+	/** Destroy the shared index and stop watching (module shutdown) */
+	static void Shutdown();
+
+	/** Check whether the shared index exists, without creating it */
+	static bool IsAvailable();
+
+	~FStationLibraryIndex();
+
+	/** Design file paths, newest first */
+	TArray<FString> GetFiles() const;
+
+	/** Find the entry for a design file, or nullptr if it is not in the designs directory */
+	const FEntry* FindEntry(const FString& FilePath) const;
+
+	/** Re-read one design file after it was written or deleted */
+	void UpdateFile(const FString& FilePath);
+
+	/** Rescan the directory, re-reading only files whose timestamp or size changed */
+	void Refresh();
+
+private:
+	FStationLibraryIndex();
+
+	/** Index file location */
+	FString GetIndexFilePath() const;
+
+	void LoadIndex();
+	void SaveIndexIfDirty();
+
+	/** Check whether a path is a design file directly inside the designs directory */
+	bool IsLibraryFile(const FString& FilePath) const;
+
+	/** Re-index or drop one changed file without saving the index */
+	void ApplyFileChange(const FString& FilePath);
+
+	/** Stat and read the metadata of one file into Entries, returns false if it is not a readable design */
+	bool IndexFile(const FString& FilePath, const FDateTime& Timestamp, int64 FileSize);
+
+	void HandleDirectoryChanged(const TArray<FFileChangeData>& Changes);
+
+	/** Designs directory (normalized, absolute) */
+	FString Directory;
+
+	/** Entries by clean filename */
+	TMap<FString, FEntry> Entries;
+	bool bDirty;
+
+	FDelegateHandle DirectoryWatcherHandle;
+
+	static TUniquePtr<FStationLibraryIndex> Instance;
+};
@@ -0,0 +1,67 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "StationDesignerTypes.h"
+#include "StationValidator.h"
+
+class FStationConnectivityTracker;
+
+/** Called on the game thread with the results of the latest validation run */
+DECLARE_DELEGATE_OneParam(FOnStationValidationComplete, const TArray<FValidationMessage>& /*Messages*/);
+
+/**
+ * Runs FStationValidator on a task graph worker so large designs never block the editor
+ * 
+ * Each request snapshots the design on the game thread. Only one run is in flight at a
+ * time; newer requests replace any queued snapshot and bump a generation counter so
+ * superseded runs are skipped or have their results dropped. Results are delivered on
+ * the game thread.
+ * 
+ * When the caller passes its FStationConnectivityTracker, the tracker is refreshed on
+ * the game thread at request time; if it reports a single component the worker skips
+ * the orphan search.
+ */
+class FStationValidationService : public TSharedFromThis<FStationValidationService>
+{
+public:
+	FStationValidationService();
+
+	/**
+	 * Snapshot a design and validate it in the background (game thread only)
+	 * @param Design Design to validate
+	 * @param ConnectivityTracker Optional tracker kept in sync with the design's edits
+	 */
+	void RequestValidation(const FStationDesign& Design, FStationConnectivityTracker* ConnectivityTracker = nullptr);
+
+	/** Drop any queued or in-flight run so its results are never delivered */
+	void Cancel();
+
+	/** Check whether a run is queued or in flight */
+	bool IsValidating() const { return bRunInFlight || PendingSnapshot.IsValid(); }
+
+	/** Delegate fired on the game thread when results for the newest request are ready */
+	FOnStationValidationComplete& OnValidationComplete() { return ValidationCompleteDelegate; }
+
+private:
+	/** Launch a worker task for a snapshot */
+	void LaunchRun(TSharedRef<const FStationDesign> Snapshot, bool bKnownFullyConnected, uint32 RunGeneration);
+
+	/** Game thread completion of a worker run */
+	void HandleRunComplete(uint32 RunGeneration, TArray<FValidationMessage>&& Messages);
+
+	/** Generation of the newest request; workers read it to detect they are stale */
+	TSharedRef<TAtomic<uint32>, ESPMode::ThreadSafe> LatestGeneration;
+
+	/** Newest snapshot waiting for the in-flight run to finish */
+	TSharedPtr<const FStationDesign> PendingSnapshot;
+
+	/** Whether the tracker proved the pending snapshot fully connected */
+	bool bPendingKnownFullyConnected;
+
+	/** Whether a worker task is currently running */
+	bool bRunInFlight;
+
+	FOnStationValidationComplete ValidationCompleteDelegate;
+};
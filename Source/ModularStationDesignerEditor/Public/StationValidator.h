@@ -46,12 +46,13 @@ class FStationValidator
 {
 public:
 	// Validate entire station design
-	static TArray<FValidationMessage> ValidateStation(const FStationDesign& Design);
+	// Pass bKnownFullyConnected when an FStationConnectivityTracker reports a single component to skip the orphan search
+	static TArray<FValidationMessage> ValidateStation(const FStationDesign& Design, bool bKnownFullyConnected = false);
 	
 private:
 	// Individual validation checks
 	static void CheckRequiredModules(const FStationDesign& Design, TArray<FValidationMessage>& OutMessages);
-	static void CheckConnectivity(const FStationDesign& Design, TArray<FValidationMessage>& OutMessages);
+	static void CheckConnectivity(const FStationDesign& Design, bool bKnownFullyConnected, TArray<FValidationMessage>& OutMessages);
 	static void CheckPowerBalance(const FStationDesign& Design, TArray<FValidationMessage>& OutMessages);
 	static void CheckModuleCompatibility(const FStationDesign& Design, TArray<FValidationMessage>& OutMessages);
 };
@@ -8,6 +8,7 @@
 #include "ModuleDiscovery.h"
 
 class FStationViewportClient;
+class FStationCommandManager;
 class FPreviewScene;
 
 /**
@@ -19,8 +20,13 @@ class SStationViewport : public SEditorViewport
 public:
 	SLATE_BEGIN_ARGS(SStationViewport)
 		: _StationDesign(nullptr)
+		, _CommandManager(nullptr)
 		{}
 		SLATE_ARGUMENT(FStationDesign*, StationDesign)
+		/** Optional command manager that adds and removals are executed through */
+		SLATE_ARGUMENT(FStationCommandManager*, CommandManager)
+		/** Called after the viewport adds, removes or clears modules */
+		SLATE_EVENT(FSimpleDelegate, OnDesignChanged)
 	SLATE_END_ARGS()
 
 	/** Constructor/Destructor */
@@ -64,9 +70,15 @@ private:
 	// Internal station design (used when no external design provided)
 	FStationDesign InternalDesign;
 
+	// Command manager owned by the window (or nullptr to edit the design directly)
+	FStationCommandManager* CommandManager;
+
 	// Selected module index
 	int32 SelectedModuleIndex;
 	
+	// Notifies the owner that the design was edited
+	FSimpleDelegate OnDesignChanged;
+	
 	// Get the active design (external if available, otherwise internal)
 	FStationDesign& GetActiveDesign() { return ExternalDesign ? *ExternalDesign : InternalDesign; }
 
@@ -5,10 +5,16 @@
 #include "CoreMinimal.h"
 #include "EditorViewportClient.h"
 #include "StationDesignerTypes.h"
+#include "VisualizationSystem.h"
+#include "Engine/StreamableManager.h"
 
 class FPreviewScene;
 class SStationViewport;
 class UStaticMeshComponent;
+class UInstancedStaticMeshComponent;
+class UStaticMesh;
+class UMaterialInterface;
+class ULineBatchComponent;
 
 /**
  * Viewport client for station designer 3D visualization
@@ -38,39 +44,157 @@ private:
 	/** Preview scene reference for spawning components */
 	FPreviewScene* PreviewScene;
 
-	/** Map of module IDs to their preview components */
-	TMap<FString, UStaticMeshComponent*> PreviewComponents;
+	/** Identifies modules that can share one instanced component */
+	struct FPreviewMeshKey
+	{
+		UStaticMesh* Mesh = nullptr;
+		TArray<UMaterialInterface*> Materials;
+
+		bool operator==(const FPreviewMeshKey& Other) const
+		{
+			return Mesh == Other.Mesh && Materials == Other.Materials;
+		}
+
+		friend uint32 GetTypeHash(const FPreviewMeshKey& Key)
+		{
+			uint32 Hash = GetTypeHash(Key.Mesh);
+			for (UMaterialInterface* Material : Key.Materials)
+			{
+				Hash = HashCombine(Hash, GetTypeHash(Material));
+			}
+			return Hash;
+		}
+	};
+
+	/** One instanced component per (mesh, material set) */
+	struct FPreviewInstanceGroup
+	{
+		UInstancedStaticMeshComponent* Component = nullptr;
+
+		/** Module owning each instance, parallel to the component's instances */
+		TArray<FString> InstanceModuleIDs;
+	};
+
+	/** Where a module's preview lives */
+	struct FPreviewInstanceRef
+	{
+		int32 GroupIndex = INDEX_NONE;
+		int32 InstanceIndex = INDEX_NONE;
+	};
+
+	/** Instanced preview groups, owned by the preview scene */
+	TArray<FPreviewInstanceGroup> PreviewGroups;
+
+	/** Group index per mesh/material key */
+	TMap<FPreviewMeshKey, int32> PreviewGroupByKey;
+
+	/** Map of module IDs to their preview instance */
+	TMap<FString, FPreviewInstanceRef> PreviewInstances;
 
 	/** Map of module IDs to their blueprint paths (for detecting changes) */
 	TMap<FString, FSoftClassPath> ModuleBlueprintPaths;
 
-	/** Update preview components to match current design */
+	/** One in-flight async load shared by every module using the same blueprint */
+	struct FPendingMeshLoad
+	{
+		TSharedPtr<FStreamableHandle> Handle;
+		TArray<FString> WaitingModuleIDs;
+	};
+
+	/** Streams module blueprints in without blocking the editor */
+	FStreamableManager StreamableManager;
+
+	/** In-flight loads per blueprint path */
+	TMap<FSoftClassPath, FPendingMeshLoad> PendingMeshLoads;
+
+	/** Module IDs currently showing a wireframe while their blueprint streams in */
+	TMap<FString, FSoftClassPath> ModulesAwaitingMesh;
+
+	/** Shared preview mesh cache generation the current previews were built from */
+	uint32 PreviewMeshCacheGeneration;
+
+	/** Show a module's mesh now if its blueprint is loaded, otherwise start or join an async load */
+	void RequestPreviewMesh(const FModulePlacement& Module);
+
+	/** Async load completion: add instances for every module still waiting on the blueprint */
+	void OnPreviewMeshLoaded(FSoftClassPath BlueprintPath);
+
+	/** Detach a module from the load it was waiting on */
+	void StopAwaitingMesh(const FString& ModuleID);
+
+	/** Cancel loads no module is waiting on anymore */
+	void CancelUnusedMeshLoads();
+
+	/** Cancel every in-flight load */
+	void CancelPendingMeshLoads();
+
+	/** Update preview instances to match current design */
 	void UpdatePreviewComponents();
 
-	/** Clear all preview components */
+	/** Clear all preview instances and their components */
 	void ClearPreviewComponents();
 
-	/** Helper function to load mesh from blueprint path */
+	/** Add an instance for a module to the group matching its mesh and materials */
+	void AddPreviewInstance(const FModulePlacement& Module, UStaticMesh* Mesh, const TArray<UMaterialInterface*>& Materials);
+
+	/** Remove a module's instance, swapping the group's last instance into its slot */
+	void RemovePreviewInstance(const FString& ModuleID);
+
+	/** Helper function to get the preview mesh for a blueprint path (through the shared cache) */
 	UStaticMesh* LoadMeshFromBlueprintPath(const FSoftClassPath& BlueprintPath, TArray<UMaterialInterface*>& OutMaterials);
 
-	/** Draw module representations */
+	/** Draw module representations, culled to the view frustum with distance LOD */
 	void DrawModules(const FSceneView* View, FPrimitiveDrawInterface* PDI);
 
+	/** Refresh the per-module color array when the design revision changes */
+	void UpdateModuleColors();
+
+	/** Pick a wireframe color from the module blueprint name */
+	static FLinearColor ClassifyModuleColor(const FSoftClassPath& BlueprintPath);
+
 	/** Draw connection wires between modules */
 	void DrawConnectionWires(const FSceneView* View, FPrimitiveDrawInterface* PDI);
 
 	/** Draw power flow visualization */
 	void DrawPowerFlow(const FSceneView* View, FPrimitiveDrawInterface* PDI);
 
-	/** Draw grid overlay */
-	void DrawGrid(const FSceneView* View, FPrimitiveDrawInterface* PDI);
+	/** Record the grid plane footprint and camera height of the view being drawn (render-safe, no scene edits) */
+	void CacheGridView(const FSceneView* View);
+
+	/**
+	 * Keep the reference grid line batch in sync with the last drawn view (called from Tick)
+	 * Only rebuilds the batch when the quantized spacing or visible region changes, and
+	 * clears it while no design is loaded
+	 */
+	void UpdateGrid();
+
+	/** Rebuild the grid line batch for a spacing and region (snapped to major lines) */
+	void RebuildGrid(float MinorSpacing, const FBox2D& Region);
 
 	/** Helper function to draw orientation axes for a module */
 	void DrawModuleAxes(FPrimitiveDrawInterface* PDI, const FVector& Location, const FTransform& Transform, float AxisLength);
 
+	/** Connection wires and power flow lines, regenerated only when the design revision changes */
+	FVisualizationCache VisualizationCache;
+
 	/** Animation time for effects */
 	float AnimationTime;
 
-	/** Cached number of grid lines (computed once) */
-	int32 CachedGridLines;
+	/** Wireframe color per module index, valid for CachedModuleColorsRevision */
+	TArray<FLinearColor> CachedModuleColors;
+	uint64 CachedModuleColorsRevision;
+
+	/** Wireframe color per blueprint, so name matching runs once per blueprint */
+	TMap<FSoftClassPath, FLinearColor> BlueprintColorCache;
+
+	/** Line batch holding the reference grid, owned by the preview scene */
+	ULineBatchComponent* GridLineBatch;
+
+	/** Spacing and region the grid batch was last built for */
+	float GridMinorSpacing;
+	FBox2D GridRegion;
+
+	/** Grid plane footprint and camera height of the last drawn view */
+	FBox2D GridViewFootprint;
+	float GridViewCameraHeight;
 };
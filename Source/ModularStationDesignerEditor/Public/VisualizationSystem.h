@@ -80,3 +80,28 @@ private:
 	// Default color scheme
 	static TMap<EStationModuleGroup, FLinearColor> CreateDefaultColorScheme();
 };
+
+/**
+ * Caches generated visualization data per design revision
+ * Draw code can query it every frame; data is only regenerated after the design changes
+ */
+class FVisualizationCache
+{
+public:
+	/** Get connection wires for a design, regenerating only if its revision changed */
+	const TArray<FVisualizationSystem::FConnectionWire>& GetConnectionWires(const FStationDesign& Design);
+	
+	/** Get power flow lines for a design, regenerating only if its revision changed */
+	const TArray<FVisualizationSystem::FPowerFlowVisualization>& GetPowerFlowLines(const FStationDesign& Design);
+	
+	/** Drop all cached data */
+	void Invalidate();
+	
+private:
+	TArray<FVisualizationSystem::FConnectionWire> ConnectionWires;
+	TArray<FVisualizationSystem::FPowerFlowVisualization> PowerFlowLines;
+	
+	/** Design revision each array was generated from (0 = never) */
+	uint64 ConnectionWiresRevision = 0;
+	uint64 PowerFlowLinesRevision = 0;
+};